@@ -22,4 +22,13 @@
 //----------------------------------------------------------------------------//
 // Export Headers                                                             //
 //----------------------------------------------------------------------------//
+#include "include/Hash.h"
+#include "include/Key.h"
 #include "include/Ini.h"
+#include "include/ConcurrentIni.h"
+#include "include/Diff.h"
+#include "include/Schema.h"
+#include "include/IniWriter.h"
+#include "include/IniOverlay.h"
+#include "include/SharedIni.h"
+#include "include/ValueReader.h"
@@ -0,0 +1,213 @@
+//~---------------------------------------------------------------------------//
+//                     _______  _______  _______  _     _                     //
+//                    |   _   ||       ||       || | _ | |                    //
+//                    |  |_|  ||       ||   _   || || || |                    //
+//                    |       ||       ||  | |  ||       |                    //
+//                    |       ||      _||  |_|  ||       |                    //
+//                    |   _   ||     |_ |       ||   _   |                    //
+//                    |__| |__||_______||_______||__| |__|                    //
+//                             www.amazingcow.com                             //
+//  File      : ConcurrentIni.h                                               //
+//  Project   : CoreIni                                                       //
+//  Date      : Oct 18, 2026                                                  //
+//  License   : GPLv3                                                         //
+//  Author    : n2omatt <n2omatt@amazingcow.com>                              //
+//  Copyright : AmazingCow - 2017, 2018                                       //
+//                                                                            //
+//  Description :                                                             //
+//    Ini that can be read and changed by many threads.                       //
+//---------------------------------------------------------------------------~//
+
+
+#pragma once
+// std
+#include <cstdint>
+#include <memory>
+#include <shared_mutex>
+#include <stdexcept>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+// CoreIni
+#include "CoreIni_Utils.h"
+#include "Convert.h"
+#include "Ini.h"
+
+
+NS_COREINI_BEGIN
+
+///-----------------------------------------------------------------------------
+/// @brief
+///   A thread safe Ini - Each section has its own reader / writer lock, so
+///   adding or removing values of a section doesn't block the readers and
+///   the writers of the others. Adding and removing sections takes a lock
+///   over the sections table, that is held just to find the section.
+/// @notes
+///   Values are returned by copy, since they can be changed right after
+///   the section lock is released.
+///   Interpolation and profiling aren't supported - Use Snapshot() to get
+///   a regular Ini with all the sections and values.
+class ConcurrentIni
+{
+    //------------------------------------------------------------------------//
+    // CTOR / DTOR                                                            //
+    //------------------------------------------------------------------------//
+public:
+    ///-------------------------------------------------------------------------
+    /// @brief
+    ///   Constructs an empty ConcurrentIni.
+    /// @see
+    ///   Ini::Ini() for the meaning of the parameters.
+    explicit ConcurrentIni(
+        uint8_t sectionDuplicateMode = Ini::INI_DUPLICATE_DISALLOW,
+        uint8_t valueDuplicateMode   = Ini::INI_DUPLICATE_DISALLOW,
+        bool    caseInsensitive      = false);
+
+    ///-------------------------------------------------------------------------
+    /// @brief
+    ///   Constructs a ConcurrentIni with a copy of the sections and values
+    ///   of ini - And the same duplicate modes and case sensitivity.
+    explicit ConcurrentIni(const Ini &ini);
+
+    ConcurrentIni(const ConcurrentIni &) = delete;
+    ConcurrentIni& operator=(const ConcurrentIni &) = delete;
+
+
+    //------------------------------------------------------------------------//
+    // Section                                                                //
+    //------------------------------------------------------------------------//
+public:
+    ///-------------------------------------------------------------------------
+    /// @throws
+    ///   An std::invalid_argument if the section exists and the section
+    ///   duplicate mode is INI_DUPLICATE_DISALLOW.
+    void AddSection(const std::string &name);
+
+    ///-------------------------------------------------------------------------
+    /// @brief
+    ///   Removes the section - Threads that are using it finish their work
+    ///   on it, the ones that come after see it as removed.
+    /// @throws
+    ///   An std::invalid_argument if the section doesn't exists.
+    void RemoveSection(const std::string &name);
+
+    bool SectionExists(const std::string &name) const;
+
+    std::vector<std::string> GetSectionNames() const;
+
+
+    //------------------------------------------------------------------------//
+    // Value                                                                  //
+    //------------------------------------------------------------------------//
+public:
+    ///-------------------------------------------------------------------------
+    /// @throws
+    ///   An std::invalid_argument if the section doesn't exists or, as
+    ///   Ini::AddValue(), if the value exists and duplicates are disallowed.
+    void AddValue(
+        const std::string &sectionName,
+        const std::string &valueName,
+        const std::string &valueContent);
+
+    ///-------------------------------------------------------------------------
+    /// @throws
+    ///   An std::invalid_argument if the section or the value doesn't exists.
+    void RemoveValue(
+        const std::string &sectionName,
+        const std::string &valueName);
+
+    ///-------------------------------------------------------------------------
+    /// @brief
+    ///   Gets a copy of the content of the value.
+    /// @throws
+    ///   An std::invalid_argument if the section or the value doesn't exists.
+    std::string GetValue(
+        const std::string &sectionName,
+        const std::string &valueName) const;
+
+    bool ValueExists(
+        const std::string &sectionName,
+        const std::string &valueName) const;
+
+    ///-------------------------------------------------------------------------
+    /// @throws
+    ///   An std::invalid_argument if the value doesn't exists or can't be
+    ///   converted to T.
+    template <typename T>
+    const T GetValueAs(
+        const std::string &sectionName,
+        const std::string &valueName) const
+    {
+        auto content = GetValue(sectionName, valueName);
+
+        T temp;
+        if(!Convert::FromChars(content.data(), content.data() + content.size(), &temp))
+        {
+            throw std::invalid_argument(
+                "Section (" + sectionName + ") - Value (" + valueName + ") " +
+                "can't be converted: (" + content + ")"
+            );
+        }
+
+        return temp;
+    }
+
+
+    //------------------------------------------------------------------------//
+    // Snapshot                                                               //
+    //------------------------------------------------------------------------//
+public:
+    ///-------------------------------------------------------------------------
+    /// @brief
+    ///   Copies all the sections and values to a regular Ini, with the
+    ///   sections in the order that they were added. Each section is
+    ///   copied at once, but writers of other sections aren't blocked.
+    Ini Snapshot() const;
+
+
+    //------------------------------------------------------------------------//
+    // Private Methods                                                        //
+    //------------------------------------------------------------------------//
+private:
+    // Each section is an Ini with just that section.
+    struct Shard
+    {
+        Shard(uint64_t shardOrder, Ini shardIni)
+            : order  (shardOrder         )
+            , removed(false              )
+            , ini    (std::move(shardIni))
+        {
+            // Empty...
+        }
+
+        mutable std::shared_mutex mutex;
+        uint64_t                  order;
+        bool                      removed;
+        Ini                       ini;
+    };
+
+    std::string SectionKey(const std::string &name) const;
+
+    std::shared_ptr<Shard> FindShard (const std::string &name) const;
+    std::shared_ptr<Shard> GetShard  (const std::string &name) const;
+    std::shared_ptr<Shard> MakeShard (const std::string &name);
+
+
+    //------------------------------------------------------------------------//
+    // iVars                                                                  //
+    //------------------------------------------------------------------------//
+private:
+    uint8_t m_sectionDuplicateMode;
+    uint8_t m_valueDuplicateMode;
+    bool    m_caseInsensitive;
+
+    // Guards the table, not the shards - It's never held while waiting
+    // for a shard lock.
+    mutable std::shared_mutex                                 m_sectionsMutex;
+    std::unordered_map<std::string, std::shared_ptr<Shard>>   m_sections;
+    uint64_t                                                  m_nextOrder;
+
+}; // class ConcurrentIni
+
+NS_COREINI_END
@@ -0,0 +1,97 @@
+//~---------------------------------------------------------------------------//
+//                     _______  _______  _______  _     _                     //
+//                    |   _   ||       ||       || | _ | |                    //
+//                    |  |_|  ||       ||   _   || || || |                    //
+//                    |       ||       ||  | |  ||       |                    //
+//                    |       ||      _||  |_|  ||       |                    //
+//                    |   _   ||     |_ |       ||   _   |                    //
+//                    |__| |__||_______||_______||__| |__|                    //
+//                             www.amazingcow.com                             //
+//  File      : Convert.h                                                     //
+//  Project   : CoreIni                                                       //
+//  Date      : Oct 18, 2026                                                  //
+//  License   : GPLv3                                                         //
+//  Author    : n2omatt <n2omatt@amazingcow.com>                              //
+//  Copyright : AmazingCow - 2017, 2018                                       //
+//                                                                            //
+//  Description :                                                             //
+//    Conversion of ranges of chars to values.                                //
+//---------------------------------------------------------------------------~//
+
+#pragma once
+// std
+#include <charconv>
+#include <sstream>
+#include <string>
+#include <system_error>
+#include <type_traits>
+// CoreIni
+#include "CoreIni_Utils.h"
+
+
+NS_COREINI_BEGIN
+namespace Convert {
+
+///-----------------------------------------------------------------------------
+/// @brief
+///   Converts the chars at [pBegin, pEnd) to T without copying them.
+/// @returns
+///   true if all the chars were used on the conversion, false otherwise.
+///   pOut is only meaningful if the conversion succeeds.
+template <typename T>
+inline typename std::enable_if<
+    std::is_arithmetic<T>::value && !std::is_same<T, bool>::value,
+    bool
+>::type
+FromChars(const char *pBegin, const char *pEnd, T *pOut) noexcept
+{
+    auto result = std::from_chars(pBegin, pEnd, *pOut);
+    return result.ec == std::errc() && result.ptr == pEnd;
+}
+
+///-----------------------------------------------------------------------------
+/// @brief
+///   Booleans are accepted as true / false or 1 / 0.
+inline bool FromChars(const char *pBegin, const char *pEnd, bool *pOut) noexcept
+{
+    using Traits_t = std::char_traits<char>;
+    auto size = size_t(pEnd - pBegin);
+
+    if((size == 4 && Traits_t::compare(pBegin, "true", 4) == 0) || (size == 1 && *pBegin == '1'))
+    {
+        *pOut = true;
+        return true;
+    }
+    if((size == 5 && Traits_t::compare(pBegin, "false", 5) == 0) || (size == 1 && *pBegin == '0'))
+    {
+        *pOut = false;
+        return true;
+    }
+
+    return false;
+}
+
+inline bool FromChars(const char *pBegin, const char *pEnd, std::string *pOut)
+{
+    pOut->assign(pBegin, pEnd);
+    return true;
+}
+
+///-----------------------------------------------------------------------------
+/// @brief
+///   Any other type is read with a stream, so it needs a copy.
+template <typename T>
+inline typename std::enable_if<
+    !std::is_arithmetic<T>::value,
+    bool
+>::type
+FromChars(const char *pBegin, const char *pEnd, T *pOut)
+{
+    std::stringstream ss(std::string(pBegin, pEnd));
+    ss >> *pOut;
+
+    return !ss.fail() && ss.peek() == EOF;
+}
+
+} // namespace Convert
+NS_COREINI_END
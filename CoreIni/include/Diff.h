@@ -0,0 +1,85 @@
+//~---------------------------------------------------------------------------//
+//                     _______  _______  _______  _     _                     //
+//                    |   _   ||       ||       || | _ | |                    //
+//                    |  |_|  ||       ||   _   || || || |                    //
+//                    |       ||       ||  | |  ||       |                    //
+//                    |       ||      _||  |_|  ||       |                    //
+//                    |   _   ||     |_ |       ||   _   |                    //
+//                    |__| |__||_______||_______||__| |__|                    //
+//                             www.amazingcow.com                             //
+//  File      : Diff.h                                                        //
+//  Project   : CoreIni                                                       //
+//  Date      : Oct 18, 2026                                                  //
+//  License   : GPLv3                                                         //
+//  Author    : n2omatt <n2omatt@amazingcow.com>                              //
+//  Copyright : AmazingCow - 2017, 2018                                       //
+//                                                                            //
+//  Description :                                                             //
+//    Structural diff between two Ini.                                        //
+//---------------------------------------------------------------------------~//
+
+#pragma once
+// std
+#include <vector>
+// CoreIni
+#include "CoreIni_Utils.h"
+#include "Ini.h"
+
+
+NS_COREINI_BEGIN
+
+///-----------------------------------------------------------------------------
+/// @brief
+///   A Value that differs between two Ini.
+/// @notes
+///   The pointers refer to the Ini objects given to Diff() and are valid
+///   as long as those objects aren't changed.
+struct ValueDiff
+{
+    const Section *pSection;  // Section on the Ini that has the value.
+    const Value   *pOld;      // nullptr if the value was added.
+    const Value   *pNew;      // nullptr if the value was removed.
+};
+
+
+///-----------------------------------------------------------------------------
+/// @brief
+///   The changes needed to go from one Ini to another.
+/// @notes
+///   Values of added or removed sections aren't reported one by one,
+///   just the section itself.
+struct IniDiff
+{
+    std::vector<const Section *> addedSections;   // From rhs.
+    std::vector<const Section *> removedSections; // From lhs.
+
+    std::vector<ValueDiff> addedValues;
+    std::vector<ValueDiff> removedValues;
+    std::vector<ValueDiff> changedValues;
+
+    inline bool IsEmpty() const noexcept
+    {
+        return addedSections  .empty()
+            && removedSections.empty()
+            && addedValues    .empty()
+            && removedValues  .empty()
+            && changedValues  .empty();
+    }
+}; // struct IniDiff
+
+
+///-----------------------------------------------------------------------------
+/// @brief
+///   Compares the sections and values of two Ini.
+/// @param lhs
+///   The "old" Ini.
+/// @param rhs
+///   The "new" Ini.
+/// @returns
+///   What was added, removed and changed from lhs to rhs.
+/// @notes
+///   Names are matched using the rules of the Ini they're being looked up.
+///   The cost is linear on the size of both Ini.
+IniDiff Diff(const Ini &lhs, const Ini &rhs);
+
+NS_COREINI_END
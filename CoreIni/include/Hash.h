@@ -0,0 +1,109 @@
+//~---------------------------------------------------------------------------//
+//                     _______  _______  _______  _     _                     //
+//                    |   _   ||       ||       || | _ | |                    //
+//                    |  |_|  ||       ||   _   || || || |                    //
+//                    |       ||       ||  | |  ||       |                    //
+//                    |       ||      _||  |_|  ||       |                    //
+//                    |   _   ||     |_ |       ||   _   |                    //
+//                    |__| |__||_______||_______||__| |__|                    //
+//                             www.amazingcow.com                             //
+//  File      : Hash.h                                                        //
+//  Project   : CoreIni                                                       //
+//  Date      : Oct 18, 2026                                                  //
+//  License   : GPLv3                                                         //
+//  Author    : n2omatt <n2omatt@amazingcow.com>                              //
+//  Copyright : AmazingCow - 2017, 2018                                       //
+//                                                                            //
+//  Description :                                                             //
+//    Hashing of Section and Value names.                                     //
+//---------------------------------------------------------------------------~//
+
+#pragma once
+// std
+#include <cstddef>
+#include <cstdint>
+// CoreIni
+#include "CoreIni_Utils.h"
+
+
+NS_COREINI_BEGIN
+namespace Hash {
+
+//----------------------------------------------------------------------------//
+// Constants                                                                  //
+//----------------------------------------------------------------------------//
+// FNV-1a 64 bits.
+constexpr uint64_t kOffsetBasis = 14695981039346656037ull;
+constexpr uint64_t kPrime       = 1099511628211ull;
+
+
+//----------------------------------------------------------------------------//
+// Functions                                                                  //
+//----------------------------------------------------------------------------//
+///-----------------------------------------------------------------------------
+/// @brief
+///   Folds the ASCII uppercase letters to lowercase, leaving all the other
+///   chars untouched - So it's locale independent.
+inline constexpr char FoldCase(char c) noexcept
+{
+    return (c >= 'A' && c <= 'Z') ? char(c - 'A' + 'a') : c;
+}
+
+///-----------------------------------------------------------------------------
+/// @brief
+///   Hashes the name - Folding the case of each char if requested, so
+///   names that differs only by the case will end up with the same hash.
+///   It's constexpr, so names known at compile time can be hashed then
+///   (see Key).
+inline constexpr uint64_t HashName(
+    const char *pName,
+    size_t      size,
+    bool        foldCase) noexcept
+{
+    auto hash = kOffsetBasis;
+    for(size_t i = 0; i < size; ++i)
+    {
+        auto c = (foldCase) ? FoldCase(pName[i]) : pName[i];
+        hash   = (hash ^ uint8_t(c)) * kPrime;
+    }
+
+    return hash;
+}
+
+///-----------------------------------------------------------------------------
+/// @brief
+///   Hashes the bytes continuing from hash - So a content split in pieces
+///   hashes the same as the whole content.
+inline constexpr uint64_t HashBytes(
+    const char *pData,
+    size_t      size,
+    uint64_t    hash = kOffsetBasis) noexcept
+{
+    for(size_t i = 0; i < size; ++i)
+        hash = (hash ^ uint8_t(pData[i])) * kPrime;
+
+    return hash;
+}
+
+///-----------------------------------------------------------------------------
+/// @brief
+///   Combines the hashes of a Section name and a Value name into a single
+///   hash that identifies the value on the whole Ini.
+inline constexpr uint64_t Combine(uint64_t sectionHash, uint64_t valueHash) noexcept
+{
+    return sectionHash ^ (valueHash * kPrime + 0x9E3779B97F4A7C15ull);
+}
+
+///-----------------------------------------------------------------------------
+/// @brief
+///   Mixes all the bits of hash (SplitMix64 finalizer) - So the low bits
+///   can be used as an index even if only the high bits of the input vary.
+inline constexpr uint64_t Mix(uint64_t hash) noexcept
+{
+    hash = (hash ^ (hash >> 30)) * 0xBF58476D1CE4E5B9ull;
+    hash = (hash ^ (hash >> 27)) * 0x94D049BB133111EBull;
+    return hash ^ (hash >> 31);
+}
+
+} // namespace Hash
+NS_COREINI_END
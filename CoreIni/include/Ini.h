@@ -21,16 +21,31 @@
 //std
 #include <stdexcept>
 #include <algorithm>
+#include <atomic>
 #include <string>
 #include <vector>
 #include <sstream>
+#include <cctype>
+#include <cstddef>
+#include <iterator>
+#include <memory>
+#include <mutex>
+#include <string_view>
+#include <unordered_map>
+#include <utility>
 // CoreIni
 #include "CoreIni_Utils.h"
+#include "Convert.h"
+#include "Hash.h"
+#include "Key.h"
 
 
 NS_COREINI_BEGIN
 
-class Ini;
+class  Ini;
+class  ValueReader;
+struct IniDiff;
+template <typename TConfig> class Schema;
 
 
 class Value
@@ -42,8 +57,11 @@ public:
     inline Value(
         const std::string &name    = "",
         const std::string &content = "") noexcept
-        : m_name   (name)
-        , m_content(content)
+        : m_name              (name)
+        , m_content           (content)
+        , m_hash              (0)
+        , m_lineNumber        (0)
+        , m_contentsHash      (Hash::HashBytes(content.data(), content.size()))
     {
         // Empty...
     }
@@ -52,8 +70,96 @@ public:
     // Public Methods                                                         //
     //------------------------------------------------------------------------//
 public:
-    inline const std::string& GetName   () const noexcept { return m_name;    }
-    inline const std::string& GetContent() const noexcept { return m_content; }
+    inline const std::string& GetName() const noexcept { return m_name; }
+
+    ///-------------------------------------------------------------------------
+    /// @brief
+    ///   Gets the content of the value.
+    /// @notes
+    ///   Values continued with backslashes are kept as pieces of the
+    ///   INI file lines and are only joined into a string on the first
+    ///   call, that releases the pieces - Use a ValueReader to read them
+    ///   without joining. The join is done once, even with concurrent
+    ///   calls for the same value.
+    inline const std::string& GetContent() const
+    {
+        if(m_pContinuation)
+            return JoinContinuation();
+
+        return m_content;
+    }
+
+    ///-------------------------------------------------------------------------
+    /// @brief
+    ///   Size of GetContent() - Without joining continued values.
+    inline size_t GetContentSize() const noexcept
+    {
+        return (m_pContinuation) ? m_pContinuation->size : m_content.size();
+    }
+
+    ///-------------------------------------------------------------------------
+    /// @brief
+    ///   Hash of the name and of all the contents of the value - Kept up
+    ///   to date by the Ini as the value changes.
+    inline uint64_t GetContentHash() const noexcept
+    {
+        return Hash::Mix(Hash::Combine(m_hash, m_contentsHash));
+    }
+
+    ///-------------------------------------------------------------------------
+    /// @brief
+    ///   Line of the INI file that the value was read, or 0 if the value
+    ///   wasn't read from a file.
+    inline size_t GetLineNumber() const noexcept { return m_lineNumber; }
+
+    ///-------------------------------------------------------------------------
+    /// @brief
+    ///   Values that are repeated on a section with INI_DUPLICATE_MERGE
+    ///   keeps all their contents, in the order that they were found.
+    ///   GetContent() is the same of GetContent(0).
+    inline size_t GetContentsCount() const noexcept
+    {
+        return 1 + m_moreContents.size();
+    }
+
+    inline const std::string& GetContent(size_t index) const
+    {
+        return (index == 0) ? GetContent() : m_moreContents[index - 1];
+    }
+
+    inline size_t GetContentSize(size_t index) const noexcept
+    {
+        return (index == 0) ? GetContentSize() : m_moreContents[index - 1].size();
+    }
+
+
+    //------------------------------------------------------------------------//
+    // Private Methods                                                        //
+    //------------------------------------------------------------------------//
+private:
+    inline const std::string& JoinContinuation() const
+    {
+        auto &continuation = *m_pContinuation;
+        if(continuation.joined.load(std::memory_order_acquire))
+            return continuation.content;
+
+        std::lock_guard<std::mutex> lock(continuation.mutex);
+        if(!continuation.joined.load(std::memory_order_relaxed))
+        {
+            continuation.content.reserve(continuation.size);
+            for(const auto &segment : continuation.segments)
+                continuation.content.append(segment.data(), segment.size());
+
+            //------------------------------------------------------------------
+            // The pieces are released when no other value needs them.
+            std::vector<std::string_view>().swap(continuation.segments);
+            continuation.pPieces.reset();
+
+            continuation.joined.store(true, std::memory_order_release);
+        }
+
+        return continuation.content;
+    }
 
 
     //------------------------------------------------------------------------//
@@ -61,13 +167,125 @@ public:
     //------------------------------------------------------------------------//
 private:
     friend class Ini;
+    friend IniDiff Diff(const Ini &lhs, const Ini &rhs);
+    template <typename TConfig> friend class Schema;
+    friend class SharedIni;
+    friend class ValueReader;
+
+    // Values continued with backslashes - Pieces kept alive by pPieces,
+    // the buffer of the pieces of all the values continued on the same
+    // file, until they're joined. Shared by the copies of the value.
+    struct Continuation
+    {
+        std::mutex                         mutex;
+        std::atomic<bool>                  joined;
+        std::string                        content;
+        size_t                             size;
+        std::vector<std::string_view>      segments;
+        std::shared_ptr<const std::string> pPieces;
+    };
 
     std::string m_name;
     std::string m_content;
+    // Contents after the first - Empty unless values are merged.
+    std::vector<std::string> m_moreContents;
+    // Hash of the name - Already case-folded if Ini is case insensitive.
+    uint64_t    m_hash;
+    size_t      m_lineNumber;
+    // Null unless the value is continued - m_content is unused then.
+    std::shared_ptr<Continuation> m_pContinuation;
+    // Hash of the contents, in order - See Ini::GetContentHash().
+    uint64_t m_contentsHash;
 
 }; // class Value
 
 
+class ValueContents
+{
+    //------------------------------------------------------------------------//
+    // Iterator                                                               //
+    //------------------------------------------------------------------------//
+public:
+    class Iterator
+    {
+    public:
+        typedef std::forward_iterator_tag iterator_category;
+        typedef std::string               value_type;
+        typedef std::ptrdiff_t            difference_type;
+        typedef const std::string*        pointer;
+        typedef const std::string&        reference;
+
+    public:
+        inline Iterator(const Value *pValue, size_t index) noexcept
+            : m_pValue(pValue)
+            , m_index (index)
+        {
+            // Empty...
+        }
+
+        inline const std::string& operator*() const
+        {
+            return m_pValue->GetContent(m_index);
+        }
+
+        inline const std::string* operator->() const
+        {
+            return &m_pValue->GetContent(m_index);
+        }
+
+        inline Iterator& operator++(   ) noexcept { ++m_index; return *this; }
+        inline Iterator  operator++(int) noexcept { auto it = *this; ++m_index; return it; }
+
+        inline bool operator==(const Iterator &rhs) const noexcept
+        {
+            return m_pValue == rhs.m_pValue && m_index == rhs.m_index;
+        }
+        inline bool operator!=(const Iterator &rhs) const noexcept
+        {
+            return !(*this == rhs);
+        }
+
+    private:
+        const Value *m_pValue;
+        size_t       m_index;
+    }; // class Iterator
+
+    //------------------------------------------------------------------------//
+    // CTOR / DTOR                                                            //
+    //------------------------------------------------------------------------//
+public:
+    inline explicit ValueContents(const Value &value) noexcept
+        : m_pValue(&value)
+    {
+        // Empty...
+    }
+
+    //------------------------------------------------------------------------//
+    // Public Methods                                                         //
+    //------------------------------------------------------------------------//
+public:
+    inline size_t GetCount() const noexcept
+    {
+        return m_pValue->GetContentsCount();
+    }
+
+    inline const std::string& operator[](size_t index) const
+    {
+        return m_pValue->GetContent(index);
+    }
+
+    inline Iterator begin() const noexcept { return Iterator(m_pValue, 0         ); }
+    inline Iterator end  () const noexcept { return Iterator(m_pValue, GetCount()); }
+
+    //------------------------------------------------------------------------//
+    // iVars                                                                  //
+    //------------------------------------------------------------------------//
+private:
+    const Value *m_pValue;
+
+}; // class ValueContents
+
+
 class Section
 {
     //------------------------------------------------------------------------//
@@ -83,8 +301,11 @@ public:
     inline Section(
         const std::string        &name    = "",
         const std::vector<Value> &values = {}) noexcept
-        : m_name  (name)
-        , m_values(values)
+        : m_name       (name)
+        , m_values     (values)
+        , m_hash       (0)
+        , m_lineNumber (0)
+        , m_contentHash(0)
     {
         // Empty...
     }
@@ -96,14 +317,36 @@ public:
     inline const std::string       & GetName  () const noexcept { return m_name;   }
     inline const std::vector<Value>& GetValues() const noexcept { return m_values; }
 
+    ///-------------------------------------------------------------------------
+    /// @brief
+    ///   Line of the INI file that the section was first found, or 0 if
+    ///   the section wasn't read from a file.
+    inline size_t GetLineNumber() const noexcept { return m_lineNumber; }
+
+    ///-------------------------------------------------------------------------
+    /// @brief
+    ///   Hash of the name and of all the values of the section, regardless
+    ///   of their order - Kept up to date by the Ini as the section changes.
+    inline uint64_t GetContentHash() const noexcept { return m_contentHash; }
+
     //------------------------------------------------------------------------//
     // iVars                                                                  //
     //------------------------------------------------------------------------//
 private:
     friend class Ini;
+    friend IniDiff Diff(const Ini &lhs, const Ini &rhs);
+    template <typename TConfig> friend class Schema;
+    friend class SharedIni;
 
     std::string        m_name;
     std::vector<Value> m_values;
+    // Hash of the name - Already case-folded if Ini is case insensitive.
+    uint64_t           m_hash;
+    size_t             m_lineNumber;
+    // Value's hash -> Index on m_values.
+    std::unordered_multimap<uint64_t, size_t> m_valuesIndex;
+    // Sum of the values' hashes and of the name's mixed hash.
+    uint64_t           m_contentHash;
 
 }; // class Section;
 
@@ -141,6 +384,58 @@ public:
         INI_DUPLICATE_MERGE
     }; // Duplicate mode.
 
+    //--------------------------------------------------------------------------
+    // Parse mode.
+    enum {
+        INI_PARSE_STRICT,   // Throws on globals / duplicates not allowed.
+        INI_PARSE_TOLERANT  // Reports them as diagnostics and goes on.
+    }; // Parse mode.
+
+    //--------------------------------------------------------------------------
+    // Diagnostic kind.
+    enum {
+        INI_DIAGNOSTIC_GLOBAL_VALUE,
+        INI_DIAGNOSTIC_DUPLICATE_VALUE,
+        INI_DIAGNOSTIC_MALFORMED_SECTION,
+        INI_DIAGNOSTIC_MISSING_DELIMITER,
+        INI_DIAGNOSTIC_EMPTY_NAME,
+        INI_DIAGNOSTIC_EMPTY_CONTENT,
+        INI_DIAGNOSTIC_BAD_QUOTES
+    }; // Diagnostic kind.
+
+    //--------------------------------------------------------------------------
+    // A problem found while parsing - Line and column are 1 based.
+    struct Diagnostic
+    {
+        size_t      lineNumber;
+        size_t      column;
+        uint8_t     kind;
+        std::string message;
+    };
+
+    //--------------------------------------------------------------------------
+    // How many times a section / value was read.
+    struct AccessCount
+    {
+        std::string sectionName;
+        std::string valueName;  // Empty for sections.
+        uint64_t    count;
+    };
+
+    // Limit of PinMostAccessedSections() / PinMostAccessedValues().
+    static constexpr size_t kMaxPinnedSections = 32;
+    static constexpr size_t kMaxPinnedValues   = 32;
+
+private:
+    //--------------------------------------------------------------------------
+    // Interpolation state of a Value - See m_interpolations.
+    enum {
+        INTERPOLATION_DIRTY,
+        INTERPOLATION_RESOLVING,
+        INTERPOLATION_PLAIN,    // Content has no references.
+        INTERPOLATION_RESOLVED
+    }; // Interpolation state of a Value.
+
 
     //------------------------------------------------------------------------//
     // CTOR / DTOR                                                            //
@@ -152,16 +447,33 @@ public:
     /// @param commentType
     ///   Which chars will be considered as comments.
     ///   Default: INI_COMMENT_DEFAULT
-    /// @param duplicateMode
-    ///   How sections and values are handled when duplicates are found.
-    ///   Default: INI_DUPLICATE_MERGE_AND_OVERWRITE
+    /// @param sectionDuplicateMode
+    ///   What AddSection() does with a section that already exists:
+    ///   INI_DUPLICATE_DISALLOW throws an std::invalid_argument,
+    ///   INI_DUPLICATE_IGNORE and INI_DUPLICATE_MERGE keep it as is and
+    ///   INI_DUPLICATE_OVERWRITE removes all its values.
+    ///   Sections repeated on the file are always merged.
+    ///   Default: INI_DUPLICATE_IGNORE
+    /// @param valueDuplicateMode
+    ///   What AddValue() and the parser do with a value that already
+    ///   exists on the section: INI_DUPLICATE_DISALLOW throws (an
+    ///   std::invalid_argument from AddValue(), an std::logic_error from
+    ///   the parser on INI_PARSE_STRICT - A diagnostic that keeps the first
+    ///   value on INI_PARSE_TOLERANT), INI_DUPLICATE_IGNORE keeps the first
+    ///   content, INI_DUPLICATE_OVERWRITE keeps the last one and
+    ///   INI_DUPLICATE_MERGE keeps all of them.
+    ///   Default: INI_DUPLICATE_IGNORE - So files with repeated values
+    ///   load and the first content is the one read, as they always did.
     /// @param allowQuoted
     ///   Values on quotes are treat as a single value, otherwise the
     ///   value is retrieved just up to the next black char.
+    ///   Comment chars and delimiters are kept inside the quotes, and the
+    ///   \" \\ \n \r \t escapes are decoded - The ones IniWriter writes.
     ///   Default: true.
     /// @param allowBackslashes
     ///   Lines ending with a backslash (\) separator are joined with the
     ///   line bellow and treated as a single line.
+    ///   The lines bellow are only trimmed - Comments chars are kept.
     ///   Default: true.
     /// @param allowGlobals
     ///
@@ -171,28 +483,44 @@ public:
     ///
     /// @param keyValueDelimiter
     ///
+    /// @param caseInsensitive
+    ///   Sections and Values names are matched regardless of their case,
+    ///   i.e. [Database] and [database] are the same section. The names
+    ///   are folded once when added, so lookups costs the same of the
+    ///   case sensitive mode. GetName() still returns the original name.
+    ///   Default: false.
+    /// @param parseMode
+    ///   INI_PARSE_STRICT throws an std::logic_error on the first global
+    ///   value (if they aren't allowed) or duplicated value (if duplicates
+    ///   are disallowed). INI_PARSE_TOLERANT skips them and goes on.
+    ///   Either way, lines that can't be parsed are skipped and every
+    ///   problem found is kept on GetDiagnostics().
+    ///   Default: INI_PARSE_STRICT.
     explicit Ini(
         const std::string &filename,
         uint8_t            commentType          = INI_COMMENT_DEFAULT,
-        uint8_t            sectionDuplicateMode = INI_DUPLICATE_DISALLOW,
-        uint8_t            valueDuplicateMode   = INI_DUPLICATE_DISALLOW,
+        uint8_t            sectionDuplicateMode = INI_DUPLICATE_IGNORE,
+        uint8_t            valueDuplicateMode   = INI_DUPLICATE_IGNORE,
         bool               allowQuoted          = true,
         bool               allowBackslashes     = true,
         bool               allowGlobals         = true,
         bool               allowHierarchy       = true,
         char               hierarchyDelimiter   = '/',
-        char               keyValueDelimiter    = '=');
+        char               keyValueDelimiter    = '=',
+        bool               caseInsensitive      = false,
+        uint8_t            parseMode            = INI_PARSE_STRICT);
 
     explicit Ini(
         uint8_t commentType          = INI_COMMENT_DEFAULT,
-        uint8_t sectionDuplicateMode = INI_DUPLICATE_DISALLOW,
-        uint8_t valueDuplicateMode   = INI_DUPLICATE_DISALLOW,
+        uint8_t sectionDuplicateMode = INI_DUPLICATE_IGNORE,
+        uint8_t valueDuplicateMode   = INI_DUPLICATE_IGNORE,
         bool    allowQuoted          = true,
         bool    allowBackslashes     = true,
         bool    allowGlobals         = true,
         bool    allowHierarchy       = true,
         char    hierarchyDelimiter   = '/',
-        char    keyValueDelimiter    = '=');
+        char    keyValueDelimiter    = '=',
+        bool    caseInsensitive      = false);
 
     //------------------------------------------------------------------------//
     //                                                                        //
@@ -200,6 +528,25 @@ public:
 public:
     void Save(const std::string &path);
 
+    ///-------------------------------------------------------------------------
+    /// @brief
+    ///   Hash of all the sections and values, regardless of their order -
+    ///   Two Ini with the same sections and values have the same hash, so
+    ///   it can tell if a config changed without saving or comparing it.
+    /// @notes
+    ///   It's updated as sections and values are added, changed or removed,
+    ///   never recomputed. Names are hashed as they're matched, so a case
+    ///   insensitive Ini hashes them folded.
+    inline uint64_t GetContentHash() const noexcept { return m_contentHash; }
+
+    ///-------------------------------------------------------------------------
+    /// @brief
+    ///   Gets the problems found while parsing the file, in line order.
+    inline const std::vector<Diagnostic>& GetDiagnostics() const noexcept
+    {
+        return m_diagnostics;
+    }
+
 
     //------------------------------------------------------------------------//
     // Add Section                                                            //
@@ -304,10 +651,12 @@ public:
         const std::string &sectionName,
         const std::string &valueName) const
     {
-        auto value = GetValue(sectionName, valueName);
+        const auto &content = (m_interpolationEnabled)
+            ? GetInterpolatedContent(sectionName, valueName)
+            : GetValue(sectionName, valueName).GetContent();
 
         std::stringstream ss;
-        ss << value.m_content;
+        ss << content;
 
         T temp;
         ss >> temp;
@@ -315,32 +664,409 @@ public:
         return temp;
     }
 
+    ///-------------------------------------------------------------------------
+    /// @brief
+    ///   Gets the value described by key converted to its type - The names
+    ///   are already hashed, so only the indexes are probed.
+    /// @throws
+    ///   An std::invalid_argument if the value doesn't exists or can't be
+    ///   converted to T.
+    template <typename T>
+    const T Get(const Key<T> &key) const
+    {
+        auto  p_section = static_cast<const Section *>(nullptr);
+        auto &value     = LookupValue(
+            key.GetSectionName(), key.GetSectionHash(m_caseInsensitive),
+            key.GetValueName  (), key.GetValueHash  (m_caseInsensitive),
+            &p_section
+        );
+
+        if(m_profilingEnabled)
+            CountAccess(*p_section, &value);
+
+        const auto &content = (m_interpolationEnabled)
+            ? Interpolate(*p_section, value)
+            : value.GetContent();
+
+        T temp;
+        if(!Convert::FromChars(content.data(), content.data() + content.size(), &temp))
+        {
+            throw std::invalid_argument(
+                "Section (" + std::string(key.GetSectionName()) + ") - " +
+                "Value ("   + std::string(key.GetValueName  ()) + ") " +
+                "can't be converted: (" + content + ")"
+            );
+        }
+
+        return temp;
+    }
+
+    ///-------------------------------------------------------------------------
+    /// @brief
+    ///   Gets all the contents of a value - More than one only if the value
+    ///   was repeated and the value duplicate mode is INI_DUPLICATE_MERGE.
+    /// @returns
+    ///   A view to the contents, valid while the value isn't changed.
+    /// @throws
+    ///   An std::invalid_argument if the value doesn't exists.
+    ValueContents GetValues(
+        const std::string &sectionName,
+        const std::string &valueName) const;
+
+    ///-------------------------------------------------------------------------
+    /// @brief
+    ///   Splits all the contents of a value by separator and converts each
+    ///   item to T - The items are converted in place, without copies.
+    ///   Surrounding spaces of the items are ignored, so as the empty ones.
+    /// @notes
+    ///   References aren't expanded, even if interpolation is enabled.
+    /// @throws
+    ///   An std::invalid_argument if the value doesn't exists or if any
+    ///   item can't be converted to T.
+    template <typename T>
+    std::vector<T> GetValueAsList(
+        const std::string &sectionName,
+        const std::string &valueName,
+        char               separator = ',') const
+    {
+        const auto &value = GetValue(sectionName, valueName);
+
+        auto list = std::vector<T>();
+        for(const auto &content : ValueContents(value))
+        {
+            auto p_begin = content.data();
+            auto p_end   = content.data() + content.size();
+
+            while(true)
+            {
+                auto p_separator = std::find(p_begin, p_end, separator);
+                auto p_item_end  = p_separator;
+
+                while(p_begin != p_item_end && std::isspace(uint8_t(*p_begin   ))) ++p_begin;
+                while(p_begin != p_item_end && std::isspace(uint8_t(p_item_end[-1]))) --p_item_end;
+
+                if(p_begin != p_item_end)
+                {
+                    T item;
+                    if(!Convert::FromChars(p_begin, p_item_end, &item))
+                    {
+                        throw std::invalid_argument(
+                            "Section (" + sectionName + ") - Value (" + valueName + ") " +
+                            "has an invalid item: (" + std::string(p_begin, p_item_end) + ")"
+                        );
+                    }
+
+                    list.push_back(std::move(item));
+                }
+
+                if(p_separator == p_end)
+                    break;
+
+                p_begin = p_separator + 1;
+            }
+        }
+
+        return list;
+    }
+
+
+    //------------------------------------------------------------------------//
+    // Interpolation                                                          //
+    //------------------------------------------------------------------------//
+public:
+    ///-------------------------------------------------------------------------
+    /// @brief
+    ///   Enables / Disables the expansion of references on GetValueAs().
+    /// @notes
+    ///   GetInterpolatedContent() always expands the references.
+    ///   Default: disabled.
+    void SetInterpolationEnabled(bool enabled) noexcept;
+    bool IsInterpolationEnabled () const noexcept;
+
+    ///-------------------------------------------------------------------------
+    /// @brief
+    ///   Gets the content of the value with all references expanded.
+    ///   A reference is written as ${section:key}, ${key} for a value of
+    ///   the same section or ${env:NAME} for an environment variable.
+    ///   $$ is expanded to a single $.
+    /// @notes
+    ///   The value is expanded on the first read and the result is kept
+    ///   until the value, or any value that it references, is changed
+    ///   with AddValue, RemoveValue etc. So the next reads cost the same of
+    ///   a GetValue(). Environment variables are read just once.
+    ///   Since the expansion is memoized even on const objects, concurrent
+    ///   reads of the same Ini must be synchronized by the caller.
+    /// @throws
+    ///   An std::invalid_argument if the value or any referenced value
+    ///   doesn't exists.
+    ///   An std::logic_error if the references have a cycle or are malformed.
+    const std::string& GetInterpolatedContent(
+        const std::string &sectionName,
+        const std::string &valueName) const;
+
+
+    //------------------------------------------------------------------------//
+    // Profiling                                                              //
+    //------------------------------------------------------------------------//
+public:
+    ///-------------------------------------------------------------------------
+    /// @brief
+    ///   Enables / Disables counting how many times each section and value
+    ///   is read by GetSection(), GetValue() and the functions built on
+    ///   them (GetValueAs(), GetValues(), etc).
+    /// @notes
+    ///   The counts are kept even on const objects, so concurrent reads
+    ///   of the same Ini must be synchronized by the caller.
+    ///   Default: disabled.
+    void SetProfilingEnabled(bool enabled) noexcept;
+    bool IsProfilingEnabled () const noexcept;
+
+    void ResetAccessCounts() noexcept;
+
+    ///-------------------------------------------------------------------------
+    /// @brief
+    ///   Gets the count most read sections / values, most read first.
+    ///   Those are the reads worth hoisting out of loops.
+    std::vector<AccessCount> GetMostAccessedSections(size_t count) const;
+    std::vector<AccessCount> GetMostAccessedValues  (size_t count) const;
+
+    ///-------------------------------------------------------------------------
+    /// @brief
+    ///   Pins the count (up to kMaxPinnedSections) most read sections on
+    ///   a small table that is checked before the hash index, so their
+    ///   lookups (GetSection(), SectionExists() and the ones of their
+    ///   values) don't touch the index at all.
+    /// @notes
+    ///   The table is dropped when any section is removed.
+    void PinMostAccessedSections(size_t count);
+    void UnpinSections() noexcept;
+
+    ///-------------------------------------------------------------------------
+    /// @brief
+    ///   Pins the count (up to kMaxPinnedValues) most read values on a
+    ///   small table that is checked before the hash index, so their
+    ///   lookups don't touch the index at all.
+    /// @notes
+    ///   The table is dropped when any section or value is removed.
+    void PinMostAccessedValues(size_t count);
+    void UnpinValues() noexcept;
+
+
+    //------------------------------------------------------------------------//
+    // Finalize                                                               //
+    //------------------------------------------------------------------------//
+public:
+    ///-------------------------------------------------------------------------
+    /// @brief
+    ///   Builds a minimal perfect hash over all the (section, value) pairs
+    ///   - Each pair gets its own slot on a dense table, without empty
+    ///   slots, so a value lookup is a single hash, index and compare.
+    ///   Meant for configs that don't change after they're loaded.
+    /// @notes
+    ///   The table replaces the index of the values of each section, so
+    ///   it doesn't add to the memory used. Adding or removing any section
+    ///   or value drops the table and rebuilds those indexes - Call it
+    ///   again after the changes. Changing the content of a value keeps it.
+    /// @returns
+    ///   true if the table was built - It isn't if there are no values or
+    ///   (very unlikely) two pairs share the same hash.
+    bool Finalize();
+    bool IsFinalized() const noexcept;
+
+
+    //------------------------------------------------------------------------//
+    // Merge                                                                  //
+    //------------------------------------------------------------------------//
+public:
+    ///-------------------------------------------------------------------------
+    /// @brief
+    ///   Applies all the sections and values of other into this Ini.
+    ///   Sections that exists on both are merged value by value.
+    /// @param other
+    ///   The Ini that will be applied - The rvalue version moves the names
+    ///   and contents instead of copying them.
+    /// @param duplicateMode
+    ///   How values that exists on both are handled - INI_DUPLICATE_MERGE
+    ///   keeps the contents of both.
+    ///   Default: INI_DUPLICATE_OVERWRITE.
+    /// @throws
+    ///   An std::invalid_argument if duplicateMode is INI_DUPLICATE_DISALLOW
+    ///   and any value exists on both - In this case nothing is merged.
+    /// @notes
+    ///   The cost is linear on the size of other. An Ini can be merged
+    ///   with itself - A copy of it is merged then.
+    void Merge(
+        const Ini &other,
+        uint8_t    duplicateMode = INI_DUPLICATE_OVERWRITE);
+
+    void Merge(
+        Ini     &&other,
+        uint8_t   duplicateMode = INI_DUPLICATE_OVERWRITE);
+
 
     //------------------------------------------------------------------------//
     // Private Methods                                                        //
     //------------------------------------------------------------------------//
 private:
+    friend IniDiff Diff(const Ini &lhs, const Ini &rhs);
+    template <typename TConfig> friend class Schema;
+    friend class SharedIni;
+    friend class IniOverlay;
+    friend class ConcurrentIni;
+
+    template <typename TIni>
+    void MergeImpl(TIni &&other, uint8_t duplicateMode);
+
     void Parse(const std::vector<std::string> &lines);
 
+    void ReadContinuation(
+        const std::vector<std::string>  &lines,
+        size_t                          *pIndex,
+        std::string_view                 content,
+        std::vector<std::string_view>   *pOut_Segments) const;
+
+    void SetSegments(
+        Section                       &section,
+        Value                         &value,
+        std::vector<std::string_view>  segments);
+
+    void CompactContinuations(
+        const std::vector<std::shared_ptr<Value::Continuation>> &continuations);
+
+    void SetContinuation(
+        Section                              &section,
+        Value                                &value,
+        std::shared_ptr<Value::Continuation>  pContinuation);
+
     bool IsCommentLine(const std::string &line) const noexcept;
 
+    void DiagnoseLine(const std::string &line, size_t lineNumber);
+
+    void AddDiagnostic(
+        size_t      lineNumber,
+        size_t      column,
+        uint8_t     kind,
+        std::string message);
+
     bool IsSectionLine(
         const std::string &line,
         std::string       *pOut_SectionName) const noexcept;
 
     bool IsValueLine(
-        const std::string        &line,
-        std::vector<std::string> *pOut_KeyVal) const noexcept;
+        const std::string &line,
+        std::string_view  *pOut_Name,
+        std::string_view  *pOut_Content,
+        std::string       *pOut_Unescaped,
+        bool              *pOut_Quoted) const;
+
+    bool IsCommentChar(char c) const noexcept;
 
 
     std::string StripComments(const std::string &line) const noexcept;
 
 
+    uint64_t HashName(std::string_view name) const noexcept;
+
+    bool NamesEqual(
+        std::string_view lhs,
+        std::string_view rhs) const noexcept;
+
+    const Section* FindSection(
+        std::string_view name,
+        uint64_t         hash) const noexcept;
+
+    const Value* FindValue(
+        const Section    &section,
+        std::string_view  name,
+        uint64_t          hash) const noexcept;
+
+    Section& InsertSection(std::string name);
+
+    Value& InsertValue(
+        Section     &section,
+        std::string  name,
+        std::string  content);
+
+    const Section& LookupSection(const std::string &name) const;
+
+    const Value& LookupValue(
+        const std::string  &sectionName,
+        const std::string  &valueName,
+        const Section     **ppSection) const;
+
+    const Value& LookupValue(
+        std::string_view    sectionName,
+        uint64_t            sectionHash,
+        std::string_view    valueName,
+        uint64_t            valueHash,
+        const Section     **ppSection) const;
+
+    const Value* FindFinalValue(
+        std::string_view    sectionName,
+        uint64_t            sectionHash,
+        std::string_view    valueName,
+        uint64_t            valueHash,
+        const Section     **ppSection) const noexcept;
+
+    static size_t FinalSlot(
+        uint64_t hash,
+        uint32_t displacement,
+        size_t   size) noexcept;
+
+    void DropFinalIndex();
+
+    void CountAccess(const Section &section, const Value *pValue) const;
+
+    void EraseAccessCounts(const Section &section) noexcept;
+
+    static std::vector<AccessCount> SortAccessCounts(
+        std::vector<AccessCount> counts,
+        size_t                   count);
+
+    void OverwriteContent(
+        Section     &section,
+        Value       &value,
+        std::string  content);
+
+    void AppendContent(
+        Section     &section,
+        Value       &value,
+        std::string  content);
+
+    void SetContentsHash(
+        Section &section,
+        Value   &value,
+        uint64_t contentsHash) noexcept;
+
+    void SetSectionContentHash(
+        Section &section,
+        uint64_t contentHash) noexcept;
+
+    void RebuildSectionsIndex();
+    void RebuildValuesIndex(Section &section);
+
+
+    const std::string& Interpolate(
+        const Section &section,
+        const Value   &value) const;
+
+    void InvalidateInterpolation(
+        const Section &section,
+        const Value   &value) const noexcept;
+
+    void InvalidateInterpolation(const Section &section) const noexcept;
+
+
     //------------------------------------------------------------------------//
     // iVars                                                                  //
     //------------------------------------------------------------------------//
 private:
     std::vector<Section> m_sections;
+    // Section's hash -> Index on m_sections.
+    std::unordered_multimap<uint64_t, size_t> m_sectionsIndex;
+    // Sum of the sections' mixed hashes - Mixed so the same value on
+    // another section changes it.
+    uint64_t m_contentHash;
 
     // Comment Type.
     uint8_t m_commentType;
@@ -354,6 +1080,59 @@ private:
     bool     m_allowHierarchy;
     char     m_hierarchyDelimiter;
     char     m_keyValueDelimiter;
+    bool     m_caseInsensitive;
+    // Parsing.
+    uint8_t                 m_parseMode;
+    std::vector<Diagnostic> m_diagnostics;
+    // Interpolation.
+    struct Interpolation
+    {
+        const Value *pValue; // Value that it was expanded for.
+        uint8_t      state;
+        std::string  content;
+    };
+
+    bool m_interpolationEnabled;
+    // Combined hash of a value -> Its memoized expansion - Only the values
+    // that were read with interpolation enabled have one.
+    mutable std::unordered_map<uint64_t, Interpolation> m_interpolations;
+    // Combined hash of a value -> Names of the values that references it.
+    mutable std::unordered_map<
+        uint64_t,
+        std::vector<std::pair<std::string, std::string>>
+    > m_interpolationDependents;
+    // Profiling - Reads by the section's hash / the combined hash of the
+    // values, so Section and Value don't carry a counter that is only
+    // used while profiling.
+    struct PinnedSection
+    {
+        uint64_t hash;
+        uint64_t accessCount;
+        uint32_t sectionIndex;
+    };
+    struct PinnedValue
+    {
+        uint64_t hash; // Combined hash.
+        uint64_t accessCount;
+        uint32_t sectionIndex;
+        uint32_t valueIndex;
+    };
+
+    bool                                           m_profilingEnabled;
+    mutable std::unordered_map<uint64_t, uint64_t> m_sectionAccessCounts;
+    mutable std::unordered_map<uint64_t, uint64_t> m_valueAccessCounts;
+    std::vector<PinnedSection>                     m_pinnedSections;
+    std::vector<PinnedValue>                       m_pinnedValues;
+    // Finalize - Displacement of each bucket and the dense table.
+    struct FinalEntry
+    {
+        uint64_t hash; // Combined hash.
+        uint32_t sectionIndex;
+        uint32_t valueIndex;
+    };
+
+    std::vector<uint32_t>   m_finalDisplacements;
+    std::vector<FinalEntry> m_finalEntries;
 
 }; // class Ini.
 
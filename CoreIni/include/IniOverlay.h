@@ -0,0 +1,220 @@
+//~---------------------------------------------------------------------------//
+//                     _______  _______  _______  _     _                     //
+//                    |   _   ||       ||       || | _ | |                    //
+//                    |  |_|  ||       ||   _   || || || |                    //
+//                    |       ||       ||  | |  ||       |                    //
+//                    |       ||      _||  |_|  ||       |                    //
+//                    |   _   ||     |_ |       ||   _   |                    //
+//                    |__| |__||_______||_______||__| |__|                    //
+//                             www.amazingcow.com                             //
+//  File      : IniOverlay.h                                                  //
+//  Project   : CoreIni                                                       //
+//  Date      : Oct 18, 2026                                                  //
+//  License   : GPLv3                                                         //
+//  Author    : n2omatt <n2omatt@amazingcow.com>                              //
+//  Copyright : AmazingCow - 2017, 2018                                       //
+//                                                                            //
+//  Description :                                                             //
+//    Layered view over a stack of Ini.                                       //
+//---------------------------------------------------------------------------~//
+
+
+#pragma once
+// std
+#include <cstddef>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <unordered_map>
+#include <vector>
+// CoreIni
+#include "CoreIni_Utils.h"
+#include "Convert.h"
+#include "Ini.h"
+
+
+NS_COREINI_BEGIN
+
+///-----------------------------------------------------------------------------
+/// @brief
+///   A read-only view over a stack of Ini (e.g base, environment, host,
+///   runtime overrides) - Each value is answered by the layer with the
+///   highest priority that has it, without copying anything.
+/// @notes
+///   Layers are kept in priority order, the last one wins.
+///   Resolved values are cached by section and by name, so the layers
+///   are only probed on the first query of each value. Changing a layer
+///   only drops the cache of the sections that it has.
+///   The layers are shared as const - If one is changed through another
+///   pointer, call ClearCache().
+///   The cache is updated on queries, so an IniOverlay can't be queried
+///   from many threads at the same time.
+class IniOverlay
+{
+    //------------------------------------------------------------------------//
+    // Enums / Constants / Typedefs                                           //
+    //------------------------------------------------------------------------//
+public:
+    typedef std::shared_ptr<const Ini> IniPtr_t;
+
+    static constexpr size_t kInvalidLayer = static_cast<size_t>(-1);
+
+
+    //------------------------------------------------------------------------//
+    // CTOR / DTOR                                                            //
+    //------------------------------------------------------------------------//
+public:
+    ///-------------------------------------------------------------------------
+    /// @brief
+    ///   Constructs a IniOverlay with the layers from the lowest to the
+    ///   highest priority.
+    /// @throws
+    ///   An std::invalid_argument if any layer is null.
+    explicit IniOverlay(std::vector<IniPtr_t> layers = {});
+
+
+    //------------------------------------------------------------------------//
+    // Layers                                                                 //
+    //------------------------------------------------------------------------//
+public:
+    ///-------------------------------------------------------------------------
+    /// @brief
+    ///   Adds a layer with higher priority than all the others.
+    /// @returns
+    ///   The index of the layer.
+    /// @throws
+    ///   An std::invalid_argument if pIni is null.
+    size_t PushLayer(IniPtr_t pIni);
+
+    ///-------------------------------------------------------------------------
+    /// @brief
+    ///   Replaces the layer at index - It takes time proportional to the
+    ///   sections of the old and of the new layer, not of the whole stack.
+    /// @throws
+    ///   An std::out_of_range if index isn't valid.
+    ///   An std::invalid_argument if pIni is null.
+    void SetLayer(size_t index, IniPtr_t pIni);
+
+    const IniPtr_t& GetLayer(size_t index) const;
+
+    inline size_t GetLayersCount() const noexcept { return m_layers.size(); }
+
+    ///-------------------------------------------------------------------------
+    /// @brief
+    ///   Drops all the resolved values.
+    void ClearCache() noexcept;
+
+
+    //------------------------------------------------------------------------//
+    // Section                                                                //
+    //------------------------------------------------------------------------//
+public:
+    ///-------------------------------------------------------------------------
+    /// @brief
+    ///   Gets the section of the highest priority layer that has it.
+    /// @throws
+    ///   An std::invalid_argument if no layer has the section.
+    const Section& GetSection(const std::string &path) const;
+
+    ///-------------------------------------------------------------------------
+    /// @brief
+    ///   Gets the names of the sections of all layers, without repeating
+    ///   them, from the highest priority layer to the lowest.
+    std::vector<std::string> GetSectionNames() const;
+
+    bool SectionExists(const std::string &path) const noexcept;
+
+
+    //------------------------------------------------------------------------//
+    // Value                                                                  //
+    //------------------------------------------------------------------------//
+public:
+    ///-------------------------------------------------------------------------
+    /// @brief
+    ///   Gets the value of the highest priority layer that has it.
+    /// @throws
+    ///   An std::invalid_argument if no layer has the value.
+    const Value& GetValue(
+        const std::string &sectionName,
+        const std::string &valueName) const;
+
+    bool ValueExists(
+        const std::string &sectionName,
+        const std::string &valueName) const;
+
+    ///-------------------------------------------------------------------------
+    /// @brief
+    ///   Gets the index of the layer that the value comes from.
+    /// @returns
+    ///   kInvalidLayer if no layer has the value.
+    size_t GetValueLayer(
+        const std::string &sectionName,
+        const std::string &valueName) const;
+
+    ///-------------------------------------------------------------------------
+    /// @throws
+    ///   An std::invalid_argument if no layer has the value or if it can't
+    ///   be converted to T.
+    template <typename T>
+    const T GetValueAs(
+        const std::string &sectionName,
+        const std::string &valueName) const
+    {
+        const auto &content = GetValue(sectionName, valueName).GetContent();
+
+        T temp;
+        if(!Convert::FromChars(content.data(), content.data() + content.size(), &temp))
+        {
+            throw std::invalid_argument(
+                "Section (" + sectionName + ") - Value (" + valueName + ") " +
+                "can't be converted: (" + content + ")"
+            );
+        }
+
+        return temp;
+    }
+
+
+    //------------------------------------------------------------------------//
+    // Private Methods                                                        //
+    //------------------------------------------------------------------------//
+private:
+    struct CacheEntry
+    {
+        const Value *pValue;
+        size_t       layer;
+    };
+
+    const CacheEntry& Resolve(
+        const std::string &sectionName,
+        const std::string &valueName) const;
+
+    void InvalidateLayer(const Ini &ini);
+
+
+    //------------------------------------------------------------------------//
+    // iVars                                                                  //
+    //------------------------------------------------------------------------//
+private:
+    std::vector<IniPtr_t> m_layers;
+    // Whether any layer is case insensitive - Once set, it's kept.
+    bool                  m_foldsCase;
+
+    // Section name -> Value name -> Resolved value.
+    //   Values that aren't on any layer are cached as well.
+    mutable std::unordered_map<
+        std::string,
+        std::unordered_map<std::string, CacheEntry>
+    > m_cache;
+
+    // Folded section name -> Section names of m_cache with that spelling.
+    //   Only kept when m_foldsCase is set - So a case insensitive layer
+    //   drops its sections whatever case they were queried with.
+    mutable std::unordered_map<
+        std::string,
+        std::vector<std::string>
+    > m_cacheSpellings;
+
+}; // class IniOverlay
+
+NS_COREINI_END
@@ -0,0 +1,187 @@
+//~---------------------------------------------------------------------------//
+//                     _______  _______  _______  _     _                     //
+//                    |   _   ||       ||       || | _ | |                    //
+//                    |  |_|  ||       ||   _   || || || |                    //
+//                    |       ||       ||  | |  ||       |                    //
+//                    |       ||      _||  |_|  ||       |                    //
+//                    |   _   ||     |_ |       ||   _   |                    //
+//                    |__| |__||_______||_______||__| |__|                    //
+//                             www.amazingcow.com                             //
+//  File      : IniWriter.h                                                   //
+//  Project   : CoreIni                                                       //
+//  Date      : Oct 18, 2026                                                  //
+//  License   : GPLv3                                                         //
+//  Author    : n2omatt <n2omatt@amazingcow.com>                              //
+//  Copyright : AmazingCow - 2017, 2018                                       //
+//                                                                            //
+//  Description :                                                             //
+//    Streaming writer of INI files.                                          //
+//---------------------------------------------------------------------------~//
+
+#pragma once
+// std
+#include <cstddef>
+#include <memory>
+#include <string>
+#include <unordered_set>
+// CoreIni
+#include "CoreIni_Utils.h"
+
+
+NS_COREINI_BEGIN
+
+class ValueReader;
+
+///-----------------------------------------------------------------------------
+/// @brief
+///   Writes sections and values, in the order that they're given, straight
+///   to a file through a fixed size buffer - So the memory used doesn't
+///   depend on the size of the output, unlike building an Ini and calling
+///   Save().
+/// @notes
+///   Contents that would be changed by the parser (surrounding spaces,
+///   comment chars, the delimiter, quotes, backslashes, line breaks or
+///   tabs) are written quoted, with \" \\ \n \r and \t escapes.
+///   Values written before any section are global values.
+class IniWriter
+{
+    //------------------------------------------------------------------------//
+    // Enums / Constants / Typedefs                                           //
+    //------------------------------------------------------------------------//
+public:
+    static constexpr size_t kDefaultBufferSize = 64 * 1024;
+
+
+    //------------------------------------------------------------------------//
+    // CTOR / DTOR                                                            //
+    //------------------------------------------------------------------------//
+public:
+    ///-------------------------------------------------------------------------
+    /// @brief
+    ///   Constructs a IniWriter that writes filename.
+    ///   The output goes to filename.tmp and it's renamed over filename
+    ///   only by Close() - So a failed write never leaves filename
+    ///   truncated or half written.
+    /// @param keyValueDelimiter
+    ///   Char put between the name and the content of the values.
+    ///   Default: '='.
+    /// @param checkDuplicates
+    ///   Throws if a section, or a value on the same section, is written
+    ///   twice. It needs to keep the names of all the sections and of the
+    ///   values of the current section.
+    ///   Default: false.
+    /// @param bufferSize
+    ///   Default: kDefaultBufferSize.
+    /// @throws
+    ///   An std::runtime_error if the file can't be opened.
+    explicit IniWriter(
+        const std::string &filename,
+        char               keyValueDelimiter = '=',
+        bool               checkDuplicates   = false,
+        size_t             bufferSize        = kDefaultBufferSize);
+
+    ///-------------------------------------------------------------------------
+    /// @brief
+    ///   Constructs a IniWriter that writes to an already opened fd.
+    ///   The fd isn't closed by the IniWriter.
+    explicit IniWriter(
+        int     fd,
+        char    keyValueDelimiter = '=',
+        bool    checkDuplicates   = false,
+        size_t  bufferSize        = kDefaultBufferSize);
+
+    ///-------------------------------------------------------------------------
+    /// @brief
+    ///   Closes the IniWriter - Errors are ignored, call Close() to get them.
+    ///   If it's destroyed by an exception, what was written to filename.tmp
+    ///   is discarded and filename is kept as it was.
+    ~IniWriter();
+
+    IniWriter(const IniWriter &) = delete;
+    IniWriter& operator=(const IniWriter &) = delete;
+
+
+    //------------------------------------------------------------------------//
+    // Write                                                                  //
+    //------------------------------------------------------------------------//
+public:
+    ///-------------------------------------------------------------------------
+    /// @throws
+    ///   An std::invalid_argument if the name is empty or has ], comment
+    ///   chars or a line break, or if checkDuplicates is set and the
+    ///   section was already written.
+    ///   An std::runtime_error if the output can't be written.
+    void WriteSection(const std::string &name);
+
+    ///-------------------------------------------------------------------------
+    /// @throws
+    ///   An std::invalid_argument if the name is empty or has the
+    ///   delimiter, comment chars, quotes or a line break, or if
+    ///   checkDuplicates is set and the value was already written on the
+    ///   current section.
+    ///   An std::runtime_error if the output can't be written.
+    void WriteValue(const std::string &name, const std::string &content);
+
+    ///-------------------------------------------------------------------------
+    /// @brief
+    ///   Writes the content of the reader, until its end, without joining
+    ///   it in a single string - Same rules of the string version.
+    void WriteValue(const std::string &name, ValueReader &reader);
+
+    ///-------------------------------------------------------------------------
+    /// @brief
+    ///   Writes everything that is buffered.
+    /// @throws
+    ///   An std::runtime_error if the output can't be written.
+    void Flush();
+
+    ///-------------------------------------------------------------------------
+    /// @brief
+    ///   Flushes and closes the file, if it was opened by the IniWriter,
+    ///   and renames it over filename. Nothing can be written after.
+    /// @throws
+    ///   An std::runtime_error if the output can't be written or renamed,
+    ///   in that case filename is kept as it was.
+    void Close();
+
+
+    //------------------------------------------------------------------------//
+    // Private Methods                                                        //
+    //------------------------------------------------------------------------//
+private:
+    void Put(char c);
+    void Put(const char *pData, size_t size);
+    void Put(const std::string &str) { Put(str.data(), str.size()); }
+
+    bool NeedsQuotes(ValueReader reader) const noexcept;
+
+    void Discard() noexcept;
+
+
+    //------------------------------------------------------------------------//
+    // iVars                                                                  //
+    //------------------------------------------------------------------------//
+private:
+    int  m_fd;
+    bool m_ownsFd;
+
+    // Only when the IniWriter opened the file.
+    std::string m_filename;
+    std::string m_tmpFilename;
+    int         m_uncaughtExceptions;
+
+    std::unique_ptr<char[]> m_pBuffer;
+    size_t                  m_bufferSize;
+    size_t                  m_bufferUsed;
+
+    char m_keyValueDelimiter;
+    bool m_hasSections;
+
+    // Duplicates.
+    bool                            m_checkDuplicates;
+    std::unordered_set<std::string> m_sectionNames;
+    std::unordered_set<std::string> m_valueNames;
+
+}; // class IniWriter
+
+NS_COREINI_END
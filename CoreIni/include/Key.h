@@ -0,0 +1,145 @@
+//~---------------------------------------------------------------------------//
+//                     _______  _______  _______  _     _                     //
+//                    |   _   ||       ||       || | _ | |                    //
+//                    |  |_|  ||       ||   _   || || || |                    //
+//                    |       ||       ||  | |  ||       |                    //
+//                    |       ||      _||  |_|  ||       |                    //
+//                    |   _   ||     |_ |       ||   _   |                    //
+//                    |__| |__||_______||_______||__| |__|                    //
+//                             www.amazingcow.com                             //
+//  File      : Key.h                                                         //
+//  Project   : CoreIni                                                       //
+//  Date      : Oct 18, 2026                                                  //
+//  License   : GPLv3                                                         //
+//  Author    : n2omatt <n2omatt@amazingcow.com>                              //
+//  Copyright : AmazingCow - 2017, 2018                                       //
+//                                                                            //
+//  Description :                                                             //
+//    Compile time descriptors of values.                                     //
+//---------------------------------------------------------------------------~//
+
+
+#pragma once
+// std
+#include <cstddef>
+#include <cstdint>
+#include <stdexcept>
+#include <string_view>
+// CoreIni
+#include "CoreIni_Utils.h"
+#include "Hash.h"
+
+
+NS_COREINI_BEGIN
+
+///-----------------------------------------------------------------------------
+/// @brief
+///   Describes a value known at compile time - Its section, its name and
+///   the type of its content. The hashes of the names are computed at
+///   compile time, so Ini::Get() goes straight to the indexes.
+/// @notes
+///   Keys are meant to be declared once as constexpr constants, so names
+///   that can't exist on an INI file (empty, with surrounding spaces or
+///   with chars that the parser would take as something else) are a
+///   compile error. Whether the value exists is only known when the
+///   Ini is read - Ini::Get() throws if it doesn't:
+///
+///     constexpr CoreIni::Key<int> kDatabasePort("database", "port");
+///     auto port = ini.Get(kDatabasePort);
+///
+///   The names must outlive the Key - String literals always do.
+template <typename T>
+class Key
+{
+    //------------------------------------------------------------------------//
+    // Enums / Constants / Typedefs                                           //
+    //------------------------------------------------------------------------//
+public:
+    typedef T Type_t;
+
+
+    //------------------------------------------------------------------------//
+    // CTOR / DTOR                                                            //
+    //------------------------------------------------------------------------//
+public:
+    template <size_t SectionSize, size_t ValueSize>
+    constexpr Key(
+        const char (&sectionName)[SectionSize],
+        const char (&valueName  )[ValueSize  ])
+        : m_sectionName      (CheckName(sectionName, SectionSize - 1, "];#\r\n"))
+        , m_valueName        (CheckName(valueName,   ValueSize   - 1, ";#\"\r\n"))
+        , m_sectionHash      (Hash::HashName(sectionName, SectionSize - 1, false))
+        , m_sectionFoldedHash(Hash::HashName(sectionName, SectionSize - 1, true ))
+        , m_valueHash        (Hash::HashName(valueName,   ValueSize   - 1, false))
+        , m_valueFoldedHash  (Hash::HashName(valueName,   ValueSize   - 1, true ))
+    {
+        static_assert(SectionSize > 1, "Section name can't be empty.");
+        static_assert(ValueSize   > 1, "Value name can't be empty."  );
+    }
+
+
+    //------------------------------------------------------------------------//
+    // Public Methods                                                         //
+    //------------------------------------------------------------------------//
+public:
+    inline constexpr std::string_view GetSectionName() const noexcept
+    {
+        return m_sectionName;
+    }
+
+    inline constexpr std::string_view GetValueName() const noexcept
+    {
+        return m_valueName;
+    }
+
+    inline constexpr uint64_t GetSectionHash(bool foldCase) const noexcept
+    {
+        return (foldCase) ? m_sectionFoldedHash : m_sectionHash;
+    }
+
+    inline constexpr uint64_t GetValueHash(bool foldCase) const noexcept
+    {
+        return (foldCase) ? m_valueFoldedHash : m_valueHash;
+    }
+
+
+    //------------------------------------------------------------------------//
+    // Private Methods                                                        //
+    //------------------------------------------------------------------------//
+private:
+    ///-------------------------------------------------------------------------
+    /// @brief
+    ///   Throwing here, while evaluating a constexpr Key, makes it a
+    ///   compile error.
+    static constexpr std::string_view CheckName(
+        const char *pName,
+        size_t      size,
+        const char *pInvalidChars)
+    {
+        auto name    = std::string_view(pName, size);
+        auto invalid = std::string_view(pInvalidChars);
+
+        if(name.find_first_of(invalid) != std::string_view::npos)
+            throw std::invalid_argument("Key name has invalid chars.");
+        if(name.front() == ' ' || name.back() == ' ')
+            throw std::invalid_argument("Key name has surrounding spaces.");
+
+        return name;
+    }
+
+
+    //------------------------------------------------------------------------//
+    // iVars                                                                  //
+    //------------------------------------------------------------------------//
+private:
+    std::string_view m_sectionName;
+    std::string_view m_valueName;
+
+    uint64_t m_sectionHash;
+    uint64_t m_sectionFoldedHash;
+    uint64_t m_valueHash;
+    uint64_t m_valueFoldedHash;
+
+}; // class Key
+
+NS_COREINI_END
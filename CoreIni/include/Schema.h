@@ -0,0 +1,468 @@
+//~---------------------------------------------------------------------------//
+//                     _______  _______  _______  _     _                     //
+//                    |   _   ||       ||       || | _ | |                    //
+//                    |  |_|  ||       ||   _   || || || |                    //
+//                    |       ||       ||  | |  ||       |                    //
+//                    |       ||      _||  |_|  ||       |                    //
+//                    |   _   ||     |_ |       ||   _   |                    //
+//                    |__| |__||_______||_______||__| |__|                    //
+//                             www.amazingcow.com                             //
+//  File      : Schema.h                                                      //
+//  Project   : CoreIni                                                       //
+//  Date      : Oct 18, 2026                                                  //
+//  License   : GPLv3                                                         //
+//  Author    : n2omatt <n2omatt@amazingcow.com>                              //
+//  Copyright : AmazingCow - 2017, 2018                                       //
+//                                                                            //
+//  Description :                                                             //
+//    Validation and binding of an Ini to an user struct.                     //
+//---------------------------------------------------------------------------~//
+
+#pragma once
+// std
+#include <functional>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <unordered_map>
+#include <vector>
+// CoreIni
+#include "CoreIni_Utils.h"
+#include "Convert.h"
+#include "Hash.h"
+#include "Ini.h"
+
+
+NS_COREINI_BEGIN
+
+///-----------------------------------------------------------------------------
+/// @brief
+///   Something of an Ini that doesn't match the Schema.
+struct SchemaViolation
+{
+    std::string sectionName;
+    std::string valueName;  // Empty for violations of the section itself.
+    size_t      lineNumber; // 0 if there's no line to point to.
+    std::string message;
+};
+
+
+///-----------------------------------------------------------------------------
+/// @brief
+///   Declares which sections and values an Ini must / may have, of which
+///   types and ranges, and to which members of TConfig they're bound.
+/// @notes
+///   The Schema is meant to be built once and used to Bind many Ini.
+///   Bind() walks the Ini just once - Each value is looked up on the
+///   schema by the hash already computed by the Ini, converted in place
+///   and stored directly on the struct.
+/// @example
+///   Schema<Config> schema;
+///   schema.AddRequired("db", "host", &Config::host);
+///   schema.AddOptional("db", "port", &Config::port, 5432);
+///   schema.SetRange   ("db", "port", 1, 65535);
+///
+///   auto violations = schema.Bind(ini, &config);
+template <typename TConfig>
+class Schema
+{
+    //------------------------------------------------------------------------//
+    // CTOR / DTOR                                                            //
+    //------------------------------------------------------------------------//
+public:
+    inline Schema() noexcept
+        : m_allowUnknown(false)
+    {
+        // Empty...
+    }
+
+
+    //------------------------------------------------------------------------//
+    // Declaration                                                            //
+    //------------------------------------------------------------------------//
+public:
+    ///-------------------------------------------------------------------------
+    /// @brief
+    ///   Declares a value that must exist. The section that holds it
+    ///   becomes required as well.
+    /// @throws
+    ///   An std::invalid_argument if the value was already declared.
+    template <typename TField>
+    void AddRequired(
+        const std::string &sectionName,
+        const std::string &valueName,
+        TField TConfig::*  pField)
+    {
+        auto &field = AddField<TField>(sectionName, valueName, pField);
+        field.required = true;
+
+        FindEntry(sectionName)->required = true;
+    }
+
+    ///-------------------------------------------------------------------------
+    /// @brief
+    ///   Declares a value that may exist - If it doesn't the defaultValue
+    ///   is stored on the struct.
+    /// @throws
+    ///   An std::invalid_argument if the value was already declared.
+    template <typename TField>
+    void AddOptional(
+        const std::string &sectionName,
+        const std::string &valueName,
+        TField TConfig::*  pField,
+        const TField      &defaultValue)
+    {
+        auto &field = AddField<TField>(sectionName, valueName, pField);
+        field.setDefault = [pField, defaultValue](TConfig *pConfig) {
+            pConfig->*pField = defaultValue;
+        };
+    }
+
+    ///-------------------------------------------------------------------------
+    /// @brief
+    ///   Restricts a declared numeric value to [min, max].
+    /// @throws
+    ///   An std::invalid_argument if the value wasn't declared or isn't
+    ///   numeric.
+    void SetRange(
+        const std::string &sectionName,
+        const std::string &valueName,
+        long double        min,
+        long double        max)
+    {
+        auto p_field = FindField(sectionName, valueName);
+        if(!p_field || !p_field->makeRange)
+        {
+            throw std::invalid_argument(
+                "Section (" + sectionName + ") - Value (" + valueName + ") " +
+                "isn't a numeric value declared on the Schema."
+            );
+        }
+
+        p_field->inRange = p_field->makeRange(min, max);
+
+        std::stringstream ss;
+        ss << "[" << min << ", " << max << "]";
+        p_field->rangeDescription = ss.str();
+    }
+
+    ///-------------------------------------------------------------------------
+    /// @brief
+    ///   Sections and values that aren't declared are reported as
+    ///   violations unless allowed.
+    ///   Default: false.
+    inline void SetAllowUnknown(bool allow) noexcept { m_allowUnknown = allow; }
+
+
+    //------------------------------------------------------------------------//
+    // Validation                                                             //
+    //------------------------------------------------------------------------//
+public:
+    ///-------------------------------------------------------------------------
+    /// @brief
+    ///   Validates the ini and stores the values on pConfig.
+    /// @returns
+    ///   All the violations found - Empty if ini matches the Schema.
+    ///   Members of values that are invalid are left unspecified.
+    /// @notes
+    ///   If interpolation is enabled on the ini, the expanded contents
+    ///   are validated.
+    std::vector<SchemaViolation> Bind(const Ini &ini, TConfig *pConfig) const
+    {
+        auto violations = std::vector<SchemaViolation>();
+        auto fold       = ini.m_caseInsensitive;
+
+        auto p_found_sections = std::vector<const Section *>(m_entries.size(), nullptr);
+        auto found_fields     = std::vector<std::vector<bool>>();
+        found_fields.reserve(m_entries.size());
+        for(const auto &entry : m_entries)
+            found_fields.emplace_back(entry.fields.size(), false);
+
+        //----------------------------------------------------------------------
+        // Everything that is on the Ini.
+        for(const auto &section : ini.m_sections)
+        {
+            auto entry_index = FindIndex(m_entriesIndex[fold], m_entries, section.m_name, section.m_hash, fold);
+            if(entry_index == kNotFound)
+            {
+                if(!m_allowUnknown)
+                    violations.push_back({section.m_name, "", section.m_lineNumber, "Unknown section."});
+
+                continue;
+            }
+
+            const auto &entry = m_entries[entry_index];
+            p_found_sections[entry_index] = &section;
+
+            for(const auto &value : section.m_values)
+            {
+                auto field_index = FindIndex(entry.fieldsIndex[fold], entry.fields, value.m_name, value.m_hash, fold);
+                if(field_index == kNotFound)
+                {
+                    if(!m_allowUnknown)
+                        violations.push_back({section.m_name, value.m_name, value.m_lineNumber, "Unknown value."});
+
+                    continue;
+                }
+
+                const auto &field = entry.fields[field_index];
+                found_fields[entry_index][field_index] = true;
+
+                const std::string *p_content = &value.GetContent();
+                if(ini.m_interpolationEnabled)
+                {
+                    try {
+                        p_content = &ini.Interpolate(section, value);
+                    } catch(const std::exception &e) {
+                        violations.push_back({section.m_name, value.m_name, value.m_lineNumber, e.what()});
+                        continue;
+                    }
+                }
+
+                auto p_begin = p_content->data();
+                auto p_end   = p_content->data() + p_content->size();
+                if(!field.convert(pConfig, p_begin, p_end))
+                {
+                    violations.push_back({
+                        section.m_name,
+                        value.m_name,
+                        value.m_lineNumber,
+                        "Invalid " + std::string(field.pTypeName) + ": (" + *p_content + ")"
+                    });
+                }
+                else if(field.inRange && !field.inRange(*pConfig))
+                {
+                    violations.push_back({
+                        section.m_name,
+                        value.m_name,
+                        value.m_lineNumber,
+                        "Out of range " + field.rangeDescription + ": (" + *p_content + ")"
+                    });
+                }
+            }
+        }
+
+        //----------------------------------------------------------------------
+        // Everything that should be on the Ini but isn't.
+        for(size_t i = 0; i < m_entries.size(); ++i)
+        {
+            const auto &entry     = m_entries[i];
+            const auto *p_section = p_found_sections[i];
+
+            if(!p_section && entry.required)
+                violations.push_back({entry.name, "", 0, "Missing required section."});
+
+            for(size_t j = 0; j < entry.fields.size(); ++j)
+            {
+                const auto &field = entry.fields[j];
+                if(found_fields[i][j])
+                    continue;
+
+                if(field.required && p_section)
+                {
+                    violations.push_back({
+                        entry.name,
+                        field.name,
+                        p_section->m_lineNumber,
+                        "Missing required value."
+                    });
+                }
+                else if(field.setDefault)
+                {
+                    field.setDefault(pConfig);
+                }
+            }
+        }
+
+        return violations;
+    }
+
+    ///-------------------------------------------------------------------------
+    /// @brief
+    ///   Same of Bind() but the values are thrown away.
+    inline std::vector<SchemaViolation> Validate(const Ini &ini) const
+    {
+        auto config = TConfig();
+        return Bind(ini, &config);
+    }
+
+
+    //------------------------------------------------------------------------//
+    // Private Types                                                          //
+    //------------------------------------------------------------------------//
+private:
+    typedef std::function<bool(const TConfig &)> RangeCheck_t;
+
+    struct Field
+    {
+        std::string  name;
+        uint64_t     hashes[2]; // Raw, case-folded.
+        bool         required;
+        const char  *pTypeName;
+
+        std::function<bool(TConfig *, const char *, const char *)> convert;
+        std::function<void(TConfig *)>                             setDefault;
+        // Only numeric fields can make a range check.
+        std::function<RangeCheck_t(long double, long double)>      makeRange;
+        RangeCheck_t                                               inRange;
+        std::string                                                rangeDescription;
+    };
+
+    struct Entry
+    {
+        std::string        name;
+        uint64_t           hashes[2]; // Raw, case-folded.
+        bool               required;
+        std::vector<Field> fields;
+        std::unordered_multimap<uint64_t, size_t> fieldsIndex[2];
+    };
+
+    static constexpr size_t kNotFound = size_t(-1);
+
+
+    //------------------------------------------------------------------------//
+    // Private Methods                                                        //
+    //------------------------------------------------------------------------//
+private:
+    template <typename TField>
+    static const char* TypeName() noexcept
+    {
+        if(std::is_same     <TField, bool       >::value) return "boolean";
+        if(std::is_integral <TField             >::value) return "integer";
+        if(std::is_floating_point<TField        >::value) return "number";
+        if(std::is_same     <TField, std::string>::value) return "string";
+        return "value";
+    }
+
+    static bool NamesEqual(
+        const std::string &lhs,
+        const std::string &rhs,
+        bool               fold) noexcept
+    {
+        if(!fold)
+            return lhs == rhs;
+        if(lhs.size() != rhs.size())
+            return false;
+
+        for(size_t i = 0; i < lhs.size(); ++i)
+        {
+            if(Hash::FoldCase(lhs[i]) != Hash::FoldCase(rhs[i]))
+                return false;
+        }
+        return true;
+    }
+
+    template <typename TItem>
+    static size_t FindIndex(
+        const std::unordered_multimap<uint64_t, size_t> &index,
+        const std::vector<TItem>                        &items,
+        const std::string                               &name,
+        uint64_t                                         hash,
+        bool                                             fold) noexcept
+    {
+        auto range = index.equal_range(hash);
+        for(auto it = range.first; it != range.second; ++it)
+        {
+            if(NamesEqual(items[it->second].name, name, fold))
+                return it->second;
+        }
+
+        return kNotFound;
+    }
+
+    Entry* FindEntry(const std::string &sectionName) noexcept
+    {
+        auto hash  = Hash::HashName(sectionName.c_str(), sectionName.size(), false);
+        auto index = FindIndex(m_entriesIndex[0], m_entries, sectionName, hash, false);
+
+        return (index == kNotFound) ? nullptr : &m_entries[index];
+    }
+
+    Field* FindField(
+        const std::string &sectionName,
+        const std::string &valueName) noexcept
+    {
+        auto p_entry = FindEntry(sectionName);
+        if(!p_entry)
+            return nullptr;
+
+        auto hash  = Hash::HashName(valueName.c_str(), valueName.size(), false);
+        auto index = FindIndex(p_entry->fieldsIndex[0], p_entry->fields, valueName, hash, false);
+
+        return (index == kNotFound) ? nullptr : &p_entry->fields[index];
+    }
+
+    template <typename TField>
+    Field& AddField(
+        const std::string &sectionName,
+        const std::string &valueName,
+        TField TConfig::*  pField)
+    {
+        if(FindField(sectionName, valueName))
+        {
+            throw std::invalid_argument(
+                "Section (" + sectionName + ") - Value (" + valueName + ") " +
+                "is already declared on the Schema."
+            );
+        }
+
+        //----------------------------------------------------------------------
+        // Section isn't declared yet.
+        auto p_entry = FindEntry(sectionName);
+        if(!p_entry)
+        {
+            m_entries.emplace_back();
+            p_entry = &m_entries.back();
+
+            p_entry->name      = sectionName;
+            p_entry->required  = false;
+            p_entry->hashes[0] = Hash::HashName(sectionName.c_str(), sectionName.size(), false);
+            p_entry->hashes[1] = Hash::HashName(sectionName.c_str(), sectionName.size(), true );
+
+            m_entriesIndex[0].emplace(p_entry->hashes[0], m_entries.size() - 1);
+            m_entriesIndex[1].emplace(p_entry->hashes[1], m_entries.size() - 1);
+        }
+
+        p_entry->fields.emplace_back();
+        auto &field = p_entry->fields.back();
+
+        field.name      = valueName;
+        field.hashes[0] = Hash::HashName(valueName.c_str(), valueName.size(), false);
+        field.hashes[1] = Hash::HashName(valueName.c_str(), valueName.size(), true );
+        field.required  = false;
+        field.pTypeName = TypeName<TField>();
+        field.convert   = [pField](TConfig *pConfig, const char *pBegin, const char *pEnd) {
+            return Convert::FromChars(pBegin, pEnd, &(pConfig->*pField));
+        };
+
+        if constexpr(std::is_arithmetic<TField>::value && !std::is_same<TField, bool>::value)
+        {
+            field.makeRange = [pField](long double min, long double max) {
+                return RangeCheck_t([pField, min, max](const TConfig &config) {
+                    auto value = static_cast<long double>(config.*pField);
+                    return value >= min && value <= max;
+                });
+            };
+        }
+
+        p_entry->fieldsIndex[0].emplace(field.hashes[0], p_entry->fields.size() - 1);
+        p_entry->fieldsIndex[1].emplace(field.hashes[1], p_entry->fields.size() - 1);
+
+        return field;
+    }
+
+
+    //------------------------------------------------------------------------//
+    // iVars                                                                  //
+    //------------------------------------------------------------------------//
+private:
+    std::vector<Entry> m_entries;
+    // Section's hash -> Index on m_entries - Raw and case-folded.
+    std::unordered_multimap<uint64_t, size_t> m_entriesIndex[2];
+
+    bool m_allowUnknown;
+
+}; // class Schema
+
+NS_COREINI_END
@@ -0,0 +1,294 @@
+//~---------------------------------------------------------------------------//
+//                     _______  _______  _______  _     _                     //
+//                    |   _   ||       ||       || | _ | |                    //
+//                    |  |_|  ||       ||   _   || || || |                    //
+//                    |       ||       ||  | |  ||       |                    //
+//                    |       ||      _||  |_|  ||       |                    //
+//                    |   _   ||     |_ |       ||   _   |                    //
+//                    |__| |__||_______||_______||__| |__|                    //
+//                             www.amazingcow.com                             //
+//  File      : SharedIni.h                                                   //
+//  Project   : CoreIni                                                       //
+//  Date      : Oct 18, 2026                                                  //
+//  License   : GPLv3                                                         //
+//  Author    : n2omatt <n2omatt@amazingcow.com>                              //
+//  Copyright : AmazingCow - 2017, 2018                                       //
+//                                                                            //
+//  Description :                                                             //
+//    Read-only Ini snapshot shared between processes.                        //
+//---------------------------------------------------------------------------~//
+
+#pragma once
+// std
+#include <cstddef>
+#include <cstdint>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <vector>
+// CoreIni
+#include "CoreIni_Utils.h"
+#include "Convert.h"
+#include "Ini.h"
+
+
+NS_COREINI_BEGIN
+
+//----------------------------------------------------------------------------//
+// Shared Memory Layout                                                       //
+//----------------------------------------------------------------------------//
+// Everything on the segment is addressed by offsets from its start, so
+// it can be mapped at any address by any process.
+namespace SharedLayout {
+    struct Header;
+    struct Pointer;
+
+    struct String
+    {
+        uint64_t offset;
+        uint64_t size;
+    };
+
+    struct Section
+    {
+        String   name;
+        uint64_t hash;
+        uint64_t firstValue;
+        uint64_t valuesCount;
+        uint64_t lineNumber;
+    };
+
+    struct Value
+    {
+        String   name;
+        uint64_t hash;
+        uint64_t section;
+        uint64_t firstContent;
+        uint64_t contentsCount;
+        uint64_t lineNumber;
+    };
+} // namespace SharedLayout
+
+
+class SharedValue
+{
+    //------------------------------------------------------------------------//
+    // CTOR / DTOR                                                            //
+    //------------------------------------------------------------------------//
+public:
+    inline SharedValue(
+        const uint8_t             *pBase,
+        const SharedLayout::Value *pValue) noexcept
+        : m_pBase (pBase )
+        , m_pValue(pValue)
+    {
+        // Empty...
+    }
+
+    //------------------------------------------------------------------------//
+    // Public Methods                                                         //
+    //------------------------------------------------------------------------//
+public:
+    std::string_view GetName   () const noexcept;
+    std::string_view GetContent() const noexcept;
+
+    size_t           GetContentsCount() const noexcept;
+    std::string_view GetContent(size_t index) const noexcept;
+
+    inline size_t GetLineNumber() const noexcept { return m_pValue->lineNumber; }
+
+    //------------------------------------------------------------------------//
+    // iVars                                                                  //
+    //------------------------------------------------------------------------//
+private:
+    const uint8_t             *m_pBase;
+    const SharedLayout::Value *m_pValue;
+
+}; // class SharedValue
+
+
+class SharedSection
+{
+    //------------------------------------------------------------------------//
+    // CTOR / DTOR                                                            //
+    //------------------------------------------------------------------------//
+public:
+    inline SharedSection(
+        const uint8_t               *pBase,
+        const SharedLayout::Section *pSection) noexcept
+        : m_pBase   (pBase   )
+        , m_pSection(pSection)
+    {
+        // Empty...
+    }
+
+    //------------------------------------------------------------------------//
+    // Public Methods                                                         //
+    //------------------------------------------------------------------------//
+public:
+    std::string_view GetName() const noexcept;
+
+    inline size_t GetValuesCount() const noexcept { return m_pSection->valuesCount; }
+    SharedValue   GetValue(size_t index) const noexcept;
+
+    inline size_t GetLineNumber() const noexcept { return m_pSection->lineNumber; }
+
+    //------------------------------------------------------------------------//
+    // iVars                                                                  //
+    //------------------------------------------------------------------------//
+private:
+    const uint8_t               *m_pBase;
+    const SharedLayout::Section *m_pSection;
+
+}; // class SharedSection
+
+
+///-----------------------------------------------------------------------------
+/// @brief
+///   A parsed Ini published on a POSIX shared memory segment, so many
+///   processes on the same host can query it without parsing the file
+///   or keeping their own copy.
+/// @notes
+///   The publisher calls SharedIni::Publish() every time the config
+///   changes, the workers attach once and check IsStale() when they
+///   want to pick the newest snapshot with Remap().
+///   Each publish fills a new segment with the next generation, only
+///   then points the name to it and marks the old one as stale - The
+///   name is never missing and workers that are still attached to the
+///   old snapshot keep reading it until they remap.
+///   There must be only one publisher for each name.
+class SharedIni
+{
+    //------------------------------------------------------------------------//
+    // Static Methods                                                         //
+    //------------------------------------------------------------------------//
+public:
+    ///-------------------------------------------------------------------------
+    /// @brief
+    ///   Publishes a snapshot of ini on the segment name (e.g "/my_config").
+    /// @returns
+    ///   The generation of the published snapshot.
+    /// @throws
+    ///   An std::runtime_error if the segment can't be created.
+    static uint64_t Publish(const std::string &name, const Ini &ini);
+
+    ///-------------------------------------------------------------------------
+    /// @brief
+    ///   Removes the name and its current snapshot - Attached workers
+    ///   aren't affected.
+    static void Unpublish(const std::string &name) noexcept;
+
+
+    //------------------------------------------------------------------------//
+    // CTOR / DTOR                                                            //
+    //------------------------------------------------------------------------//
+public:
+    ///-------------------------------------------------------------------------
+    /// @brief
+    ///   Attaches read-only to the snapshot published on name.
+    /// @throws
+    ///   An std::runtime_error if the segment doesn't exists or isn't a
+    ///   valid snapshot.
+    explicit SharedIni(const std::string &name);
+    ~SharedIni();
+
+    SharedIni(const SharedIni &) = delete;
+    SharedIni& operator=(const SharedIni &) = delete;
+
+    SharedIni(SharedIni &&other) noexcept;
+    SharedIni& operator=(SharedIni &&other) noexcept;
+
+
+    //------------------------------------------------------------------------//
+    // Generation                                                             //
+    //------------------------------------------------------------------------//
+public:
+    uint64_t GetGeneration() const noexcept;
+
+    ///-------------------------------------------------------------------------
+    /// @brief
+    ///   true if a newer snapshot was published after this one.
+    bool IsStale() const noexcept;
+
+    ///-------------------------------------------------------------------------
+    /// @brief
+    ///   Attaches to the newest snapshot - All the SharedSection and
+    ///   SharedValue got before are invalidated.
+    /// @throws
+    ///   An std::runtime_error if the segment can't be attached, in that
+    ///   case this object keeps the current snapshot.
+    void Remap();
+
+
+    //------------------------------------------------------------------------//
+    // Get Section                                                            //
+    //------------------------------------------------------------------------//
+public:
+    SharedSection GetSection(const std::string &path) const;
+
+    std::vector<std::string> GetSectionNames() const;
+
+    bool SectionExists(const std::string &path) const noexcept;
+
+
+    //------------------------------------------------------------------------//
+    // Get Value                                                              //
+    //------------------------------------------------------------------------//
+public:
+    SharedValue GetValue(
+        const std::string &sectionName,
+        const std::string &valueName) const;
+
+    bool ValueExists(
+        const std::string &sectionName,
+        const std::string &valueName) const noexcept;
+
+    ///-------------------------------------------------------------------------
+    /// @throws
+    ///   An std::invalid_argument if the value doesn't exists or can't be
+    ///   converted to T.
+    template <typename T>
+    const T GetValueAs(
+        const std::string &sectionName,
+        const std::string &valueName) const
+    {
+        auto content = GetValue(sectionName, valueName).GetContent();
+
+        T temp;
+        if(!Convert::FromChars(content.data(), content.data() + content.size(), &temp))
+        {
+            throw std::invalid_argument(
+                "Section (" + sectionName + ") - Value (" + valueName + ") " +
+                "can't be converted: (" + std::string(content) + ")"
+            );
+        }
+
+        return temp;
+    }
+
+
+    //------------------------------------------------------------------------//
+    // Private Methods                                                        //
+    //------------------------------------------------------------------------//
+private:
+    void Attach(const std::string &name);
+    void Detach() noexcept;
+
+    const SharedLayout::Header & GetHeader() const noexcept;
+    const SharedLayout::Section* FindSection(const std::string &name) const noexcept;
+    const SharedLayout::Value  * FindValue(
+        const std::string &sectionName,
+        const std::string &valueName) const noexcept;
+
+
+    //------------------------------------------------------------------------//
+    // iVars                                                                  //
+    //------------------------------------------------------------------------//
+private:
+    std::string    m_name;
+    const uint8_t *m_pBase;
+    size_t         m_size;
+
+}; // class SharedIni
+
+NS_COREINI_END
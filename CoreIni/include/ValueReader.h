@@ -0,0 +1,121 @@
+//~---------------------------------------------------------------------------//
+//                     _______  _______  _______  _     _                     //
+//                    |   _   ||       ||       || | _ | |                    //
+//                    |  |_|  ||       ||   _   || || || |                    //
+//                    |       ||       ||  | |  ||       |                    //
+//                    |       ||      _||  |_|  ||       |                    //
+//                    |   _   ||     |_ |       ||   _   |                    //
+//                    |__| |__||_______||_______||__| |__|                    //
+//                             www.amazingcow.com                             //
+//  File      : ValueReader.h                                                 //
+//  Project   : CoreIni                                                       //
+//  Date      : Oct 18, 2026                                                  //
+//  License   : GPLv3                                                         //
+//  Author    : n2omatt <n2omatt@amazingcow.com>                              //
+//  Copyright : AmazingCow - 2017, 2018                                       //
+//                                                                            //
+//  Description :                                                             //
+//    Reads the content of a value in pieces.                                 //
+//---------------------------------------------------------------------------~//
+
+
+#pragma once
+// std
+#include <cstddef>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <vector>
+// CoreIni
+#include "CoreIni_Utils.h"
+#include "Ini.h"
+
+
+NS_COREINI_BEGIN
+
+///-----------------------------------------------------------------------------
+/// @brief
+///   Reads the content of a Value without joining it in a single string.
+///   Values continued with backslashes are kept as pieces of the INI file
+///   lines - ReadChunk() gives them one at a time without any copy and
+///   Read() copies them to a caller buffer of any size.
+/// @notes
+///   The Value must outlive the ValueReader and must not be changed
+///   while it's being read - Joining it with GetContent() is fine.
+class ValueReader
+{
+    //------------------------------------------------------------------------//
+    // CTOR / DTOR                                                            //
+    //------------------------------------------------------------------------//
+public:
+    ///-------------------------------------------------------------------------
+    /// @brief
+    ///   Reads the content at index of the value - See
+    ///   Value::GetContent(size_t).
+    explicit ValueReader(const Value &value, size_t index = 0);
+
+    ///-------------------------------------------------------------------------
+    /// @brief
+    ///   Reads a plain string - The string must outlive the ValueReader.
+    explicit ValueReader(std::string_view content);
+
+    explicit ValueReader(const std::string &content)
+        : ValueReader(std::string_view(content))
+    {
+        // Empty...
+    }
+
+
+    //------------------------------------------------------------------------//
+    // Read                                                                   //
+    //------------------------------------------------------------------------//
+public:
+    ///-------------------------------------------------------------------------
+    /// @brief
+    ///   Size of the whole content - The same of Value::GetContentSize().
+    inline size_t GetSize() const noexcept { return m_size; }
+
+    ///-------------------------------------------------------------------------
+    /// @brief
+    ///   Whether all the content was read.
+    inline bool IsEof() const noexcept
+    {
+        return m_chunkIndex >= m_chunks.size();
+    }
+
+    ///-------------------------------------------------------------------------
+    /// @brief
+    ///   Gets the rest of the current piece of the content.
+    /// @returns
+    ///   An empty string_view after the end.
+    std::string_view ReadChunk() noexcept;
+
+    ///-------------------------------------------------------------------------
+    /// @brief
+    ///   Copies up to size chars of the content to pBuffer.
+    /// @returns
+    ///   How many chars were copied - Less than size only at the end.
+    size_t Read(char *pBuffer, size_t size) noexcept;
+
+
+    //------------------------------------------------------------------------//
+    // Private Methods                                                        //
+    //------------------------------------------------------------------------//
+private:
+    void SkipEmptyChunks() noexcept;
+
+
+    //------------------------------------------------------------------------//
+    // iVars                                                                  //
+    //------------------------------------------------------------------------//
+private:
+    std::vector<std::string_view> m_chunks;
+    size_t                        m_chunkIndex;
+    size_t                        m_chunkOffset;
+    size_t                        m_size;
+    // Pieces of a continued value - It may be joined while being read.
+    std::shared_ptr<const std::string> m_pPieces;
+
+}; // class ValueReader
+
+NS_COREINI_END
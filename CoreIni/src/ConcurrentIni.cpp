@@ -0,0 +1,341 @@
+//~---------------------------------------------------------------------------//
+//                     _______  _______  _______  _     _                     //
+//                    |   _   ||       ||       || | _ | |                    //
+//                    |  |_|  ||       ||   _   || || || |                    //
+//                    |       ||       ||  | |  ||       |                    //
+//                    |       ||      _||  |_|  ||       |                    //
+//                    |   _   ||     |_ |       ||   _   |                    //
+//                    |__| |__||_______||_______||__| |__|                    //
+//                             www.amazingcow.com                             //
+//  File      : ConcurrentIni.cpp                                             //
+//  Project   : CoreIni                                                       //
+//  Date      : Oct 18, 2026                                                  //
+//  License   : GPLv3                                                         //
+//  Author    : n2omatt <n2omatt@amazingcow.com>                              //
+//  Copyright : AmazingCow - 2017, 2018                                       //
+//                                                                            //
+//  Description :                                                             //
+//    Ini that can be read and changed by many threads.                       //
+//---------------------------------------------------------------------------~//
+
+
+
+// Header
+#include "../include/ConcurrentIni.h"
+// std
+#include <algorithm>
+#include <mutex>
+// CoreIni
+#include "CoreIni_Private.h"
+
+// Usings
+USING_NS_COREINI;
+
+
+//----------------------------------------------------------------------------//
+// CTOR / DTOR                                                                //
+//----------------------------------------------------------------------------//
+ConcurrentIni::ConcurrentIni(
+    uint8_t sectionDuplicateMode, /* = INI_DUPLICATE_DISALLOW */
+    uint8_t valueDuplicateMode,   /* = INI_DUPLICATE_DISALLOW */
+    bool    caseInsensitive)      /* = false                  */
+    // Members
+    : m_sectionDuplicateMode(sectionDuplicateMode)
+    , m_valueDuplicateMode  (  valueDuplicateMode)
+    , m_caseInsensitive     (     caseInsensitive)
+    , m_nextOrder           (                   0)
+{
+    // Empty...
+}
+
+ConcurrentIni::ConcurrentIni(const Ini &ini)
+    : ConcurrentIni(
+        ini.m_sectionDuplicateMode,
+        ini.m_valueDuplicateMode,
+        ini.m_caseInsensitive
+    )
+{
+    //--------------------------------------------------------------------------
+    // Nobody else can see this object yet - No locks needed.
+    //   The contents are joined here, so the lazy join of continued values
+    //   never happens under a shared lock.
+    for(const auto &section : ini.GetSections())
+    {
+        auto &shard_ini = MakeShard(section.GetName())->ini;
+        for(const auto &value : section.GetValues())
+        {
+            for(const auto &content : ValueContents(value))
+                shard_ini.AddValue(section.GetName(), value.GetName(), content);
+        }
+    }
+}
+
+
+//----------------------------------------------------------------------------//
+// Section                                                                    //
+//----------------------------------------------------------------------------//
+void ConcurrentIni::AddSection(const std::string &name)
+{
+    auto p_old = std::shared_ptr<Shard>();
+    {
+        std::unique_lock<std::shared_mutex> lock(m_sectionsMutex);
+
+        auto it = m_sections.find(SectionKey(name));
+        if(it == std::end(m_sections))
+        {
+            MakeShard(name);
+            return;
+        }
+
+        INI_THROW_IF(
+            m_sectionDuplicateMode == Ini::INI_DUPLICATE_DISALLOW,
+            std::invalid_argument,
+            "Section: (%s) already exists",
+            name.c_str()
+        );
+
+        if(m_sectionDuplicateMode != Ini::INI_DUPLICATE_OVERWRITE)
+            return;
+
+        //----------------------------------------------------------------------
+        // Overwrite mode - The section starts empty again.
+        p_old = std::move(it->second);
+        m_sections.erase(it);
+        MakeShard(name);
+    }
+
+    //--------------------------------------------------------------------------
+    // Threads that are still using the old one finish their work on it
+    // - Waiting for them while holding the table would block all the
+    // other sections.
+    std::unique_lock<std::shared_mutex> shard_lock(p_old->mutex);
+    p_old->removed = true;
+}
+
+void ConcurrentIni::RemoveSection(const std::string &name)
+{
+    auto p_shard = std::shared_ptr<Shard>();
+    {
+        std::unique_lock<std::shared_mutex> lock(m_sectionsMutex);
+
+        auto it = m_sections.find(SectionKey(name));
+        INI_THROW_IF(
+            it == std::end(m_sections),
+            std::invalid_argument,
+            "Section: (%s) doesn't exists",
+            name.c_str()
+        );
+
+        p_shard = std::move(it->second);
+        m_sections.erase(it);
+    }
+
+    //--------------------------------------------------------------------------
+    // Marked after the table is released - See AddSection().
+    std::unique_lock<std::shared_mutex> shard_lock(p_shard->mutex);
+    p_shard->removed = true;
+}
+
+bool ConcurrentIni::SectionExists(const std::string &name) const
+{
+    return FindShard(name) != nullptr;
+}
+
+std::vector<std::string> ConcurrentIni::GetSectionNames() const
+{
+    auto names = std::vector<std::string>();
+
+    std::shared_lock<std::shared_mutex> lock(m_sectionsMutex);
+    names.reserve(m_sections.size());
+
+    //--------------------------------------------------------------------------
+    // The name of a section never changes - So no shard lock needed.
+    for(const auto &pair : m_sections)
+        names.push_back(pair.second->ini.GetSections().front().GetName());
+
+    return names;
+}
+
+
+//----------------------------------------------------------------------------//
+// Value                                                                      //
+//----------------------------------------------------------------------------//
+void ConcurrentIni::AddValue(
+    const std::string &sectionName,
+    const std::string &valueName,
+    const std::string &valueContent)
+{
+    auto p_shard = GetShard(sectionName);
+
+    std::unique_lock<std::shared_mutex> lock(p_shard->mutex);
+    INI_THROW_IF(
+        p_shard->removed,
+        std::invalid_argument,
+        "Section: (%s) doesn't exists",
+        sectionName.c_str()
+    );
+
+    const auto &name = p_shard->ini.GetSections().front().GetName();
+    p_shard->ini.AddValue(name, valueName, valueContent);
+}
+
+void ConcurrentIni::RemoveValue(
+    const std::string &sectionName,
+    const std::string &valueName)
+{
+    auto p_shard = GetShard(sectionName);
+
+    std::unique_lock<std::shared_mutex> lock(p_shard->mutex);
+    INI_THROW_IF(
+        p_shard->removed,
+        std::invalid_argument,
+        "Section: (%s) doesn't exists",
+        sectionName.c_str()
+    );
+
+    const auto &name = p_shard->ini.GetSections().front().GetName();
+    p_shard->ini.RemoveValue(name, valueName);
+}
+
+std::string ConcurrentIni::GetValue(
+    const std::string &sectionName,
+    const std::string &valueName) const
+{
+    auto p_shard = GetShard(sectionName);
+
+    std::shared_lock<std::shared_mutex> lock(p_shard->mutex);
+    INI_THROW_IF(
+        p_shard->removed,
+        std::invalid_argument,
+        "Section: (%s) doesn't exists",
+        sectionName.c_str()
+    );
+
+    const auto &name = p_shard->ini.GetSections().front().GetName();
+    return p_shard->ini.GetValue(name, valueName).GetContent();
+}
+
+bool ConcurrentIni::ValueExists(
+    const std::string &sectionName,
+    const std::string &valueName) const
+{
+    auto p_shard = FindShard(sectionName);
+    if(!p_shard)
+        return false;
+
+    std::shared_lock<std::shared_mutex> lock(p_shard->mutex);
+    if(p_shard->removed)
+        return false;
+
+    const auto &name = p_shard->ini.GetSections().front().GetName();
+    return p_shard->ini.ValueExists(name, valueName);
+}
+
+
+//----------------------------------------------------------------------------//
+// Snapshot                                                                   //
+//----------------------------------------------------------------------------//
+Ini ConcurrentIni::Snapshot() const
+{
+    auto shards = std::vector<std::shared_ptr<Shard>>();
+    {
+        std::shared_lock<std::shared_mutex> lock(m_sectionsMutex);
+
+        shards.reserve(m_sections.size());
+        for(const auto &pair : m_sections)
+            shards.push_back(pair.second);
+    }
+
+    std::sort(
+        std::begin(shards),
+        std::end  (shards),
+        [](const std::shared_ptr<Shard> &lhs, const std::shared_ptr<Shard> &rhs) {
+            return lhs->order < rhs->order;
+        }
+    );
+
+    auto ini = Ini(
+        Ini::INI_COMMENT_DEFAULT,
+        m_sectionDuplicateMode,
+        m_valueDuplicateMode,
+        true, true, true, true, '/', '=',
+        m_caseInsensitive
+    );
+
+    for(const auto &p_shard : shards)
+    {
+        std::shared_lock<std::shared_mutex> lock(p_shard->mutex);
+        if(p_shard->removed)
+            continue;
+
+        const auto &section = p_shard->ini.GetSections().front();
+        ini.AddSection(section.GetName());
+
+        for(const auto &value : section.GetValues())
+        {
+            for(const auto &content : ValueContents(value))
+                ini.AddValue(section.GetName(), value.GetName(), content);
+        }
+    }
+
+    return ini;
+}
+
+
+//----------------------------------------------------------------------------//
+// Private Methods                                                            //
+//----------------------------------------------------------------------------//
+std::string ConcurrentIni::SectionKey(const std::string &name) const
+{
+    if(!m_caseInsensitive)
+        return name;
+
+    auto key = name;
+    for(auto &c : key)
+        c = Hash::FoldCase(c);
+
+    return key;
+}
+
+std::shared_ptr<ConcurrentIni::Shard> ConcurrentIni::FindShard(
+    const std::string &name) const
+{
+    auto key = SectionKey(name);
+
+    std::shared_lock<std::shared_mutex> lock(m_sectionsMutex);
+
+    auto it = m_sections.find(key);
+    return (it != std::end(m_sections)) ? it->second : nullptr;
+}
+
+std::shared_ptr<ConcurrentIni::Shard> ConcurrentIni::GetShard(
+    const std::string &name) const
+{
+    auto p_shard = FindShard(name);
+    INI_THROW_IF(
+        !p_shard,
+        std::invalid_argument,
+        "Section: (%s) doesn't exists",
+        name.c_str()
+    );
+
+    return p_shard;
+}
+
+std::shared_ptr<ConcurrentIni::Shard> ConcurrentIni::MakeShard(
+    const std::string &name)
+{
+    auto ini = Ini(
+        Ini::INI_COMMENT_DEFAULT,
+        Ini::INI_DUPLICATE_DISALLOW,
+        m_valueDuplicateMode,
+        true, true, true, true, '/', '=',
+        m_caseInsensitive
+    );
+    ini.AddSection(name);
+
+    auto p_shard = std::make_shared<Shard>(m_nextOrder++, std::move(ini));
+    m_sections.emplace(SectionKey(name), p_shard);
+
+    return p_shard;
+}
@@ -0,0 +1,33 @@
+//~---------------------------------------------------------------------------//
+//                     _______  _______  _______  _     _                     //
+//                    |   _   ||       ||       || | _ | |                    //
+//                    |  |_|  ||       ||   _   || || || |                    //
+//                    |       ||       ||  | |  ||       |                    //
+//                    |       ||      _||  |_|  ||       |                    //
+//                    |   _   ||     |_ |       ||   _   |                    //
+//                    |__| |__||_______||_______||__| |__|                    //
+//                             www.amazingcow.com                             //
+//  File      : CoreIni_Private.h                                             //
+//  Project   : CoreIni                                                       //
+//  Date      : Oct 18, 2026                                                  //
+//  License   : GPLv3                                                         //
+//  Author    : n2omatt <n2omatt@amazingcow.com>                              //
+//  Copyright : AmazingCow - 2017, 2018                                       //
+//                                                                            //
+//  Description :                                                             //
+//    Helpers shared by the CoreIni sources - Not exported.                   //
+//---------------------------------------------------------------------------~//
+
+#pragma once
+// Amazing Cow Libs
+#include "CoreString/CoreString.h"
+
+
+//----------------------------------------------------------------------------//
+// Macros                                                                     //
+//----------------------------------------------------------------------------//
+#define INI_THROW_IF(_cond_, _exception_, _fmt_, ...)                     \
+    do {                                                                  \
+        if((_cond_))                                                     \
+            throw _exception_(CoreString::Format(_fmt_,  ##__VA_ARGS__)); \
+    } while(0)
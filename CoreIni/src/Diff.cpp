@@ -0,0 +1,158 @@
+//~---------------------------------------------------------------------------//
+//                     _______  _______  _______  _     _                     //
+//                    |   _   ||       ||       || | _ | |                    //
+//                    |  |_|  ||       ||   _   || || || |                    //
+//                    |       ||       ||  | |  ||       |                    //
+//                    |       ||      _||  |_|  ||       |                    //
+//                    |   _   ||     |_ |       ||   _   |                    //
+//                    |__| |__||_______||_______||__| |__|                    //
+//                             www.amazingcow.com                             //
+//  File      : Diff.cpp                                                      //
+//  Project   : CoreIni                                                       //
+//  Date      : Oct 18, 2026                                                  //
+//  License   : GPLv3                                                         //
+//  Author    : n2omatt <n2omatt@amazingcow.com>                              //
+//  Copyright : AmazingCow - 2017, 2018                                       //
+//                                                                            //
+//  Description :                                                             //
+//    Structural diff between two Ini.                                        //
+//---------------------------------------------------------------------------~//
+
+
+// Header
+#include "../include/Diff.h"
+
+// std
+#include <algorithm>
+#include <string_view>
+// CoreIni
+#include "../include/ValueReader.h"
+
+// Usings
+USING_NS_COREINI;
+
+
+//----------------------------------------------------------------------------//
+// Helpers                                                                    //
+//----------------------------------------------------------------------------//
+namespace {
+
+// Compares piece by piece - Continued values aren't joined.
+bool SameContent(ValueReader lhs, ValueReader rhs) noexcept
+{
+    if(lhs.GetSize() != rhs.GetSize())
+        return false;
+
+    auto lhs_chunk = std::string_view();
+    auto rhs_chunk = std::string_view();
+    while(true)
+    {
+        if(lhs_chunk.empty()) lhs_chunk = lhs.ReadChunk();
+        if(rhs_chunk.empty()) rhs_chunk = rhs.ReadChunk();
+        if(lhs_chunk.empty() || rhs_chunk.empty())
+            return lhs_chunk.empty() && rhs_chunk.empty();
+
+        auto count = std::min(lhs_chunk.size(), rhs_chunk.size());
+        if(lhs_chunk.substr(0, count) != rhs_chunk.substr(0, count))
+            return false;
+
+        lhs_chunk.remove_prefix(count);
+        rhs_chunk.remove_prefix(count);
+    }
+}
+
+bool SameContents(const Value &lhs, const Value &rhs)
+{
+    if(lhs.GetContentsCount() != rhs.GetContentsCount())
+        return false;
+
+    for(size_t i = 0; i < lhs.GetContentsCount(); ++i)
+    {
+        if(!SameContent(ValueReader(lhs, i), ValueReader(rhs, i)))
+            return false;
+    }
+
+    return true;
+}
+
+} // anonymous namespace
+
+
+//----------------------------------------------------------------------------//
+// Diff                                                                       //
+//----------------------------------------------------------------------------//
+IniDiff CoreIni::Diff(const Ini &lhs, const Ini &rhs)
+{
+    auto diff = IniDiff();
+
+    //--------------------------------------------------------------------------
+    // The hashes can be reused if both Inis fold the names the same.
+    auto same_hashing = (lhs.m_caseInsensitive == rhs.m_caseInsensitive);
+    auto hash_on = [same_hashing](
+        const Ini         &ini,
+        uint64_t           hash,
+        const std::string &name)
+    {
+        return (same_hashing) ? hash : ini.HashName(name);
+    };
+
+    //--------------------------------------------------------------------------
+    // Removed and changed - Everything of lhs looked up on rhs.
+    for(const auto &lhs_section : lhs.GetSections())
+    {
+        auto p_rhs_section = rhs.FindSection(
+            lhs_section.GetName(),
+            hash_on(rhs, lhs_section.m_hash, lhs_section.GetName())
+        );
+
+        if(!p_rhs_section)
+        {
+            diff.removedSections.push_back(&lhs_section);
+            continue;
+        }
+
+        for(const auto &lhs_value : lhs_section.GetValues())
+        {
+            auto p_rhs_value = rhs.FindValue(
+                *p_rhs_section,
+                lhs_value.GetName(),
+                hash_on(rhs, lhs_value.m_hash, lhs_value.GetName())
+            );
+
+            if(!p_rhs_value)
+                diff.removedValues.push_back({&lhs_section, &lhs_value, nullptr});
+            else if(!SameContents(*p_rhs_value, lhs_value))
+                diff.changedValues.push_back({p_rhs_section, &lhs_value, p_rhs_value});
+        }
+    }
+
+    //--------------------------------------------------------------------------
+    // Added - Everything of rhs that isn't on lhs.
+    for(const auto &rhs_section : rhs.GetSections())
+    {
+        auto p_lhs_section = lhs.FindSection(
+            rhs_section.GetName(),
+            hash_on(lhs, rhs_section.m_hash, rhs_section.GetName())
+        );
+
+        if(!p_lhs_section)
+        {
+            diff.addedSections.push_back(&rhs_section);
+            continue;
+        }
+
+        for(const auto &rhs_value : rhs_section.GetValues())
+        {
+            auto p_lhs_value = lhs.FindValue(
+                *p_lhs_section,
+                rhs_value.GetName(),
+                hash_on(lhs, rhs_value.m_hash, rhs_value.GetName())
+            );
+
+            if(!p_lhs_value)
+                diff.addedValues.push_back({&rhs_section, nullptr, &rhs_value});
+        }
+    }
+
+    return diff;
+}
@@ -21,28 +21,80 @@
 #include "../include/Ini.h"
 // std
 #include <algorithm>
+#include <cstdlib>
 #include <iterator>
 #include <stdexcept>
 #include <sstream>
+#include <type_traits>
+#include <utility>
 // Amazing Cow Libs
 #include "acow/cpp_goodies.h"
 #include "CoreAssert/CoreAssert.h"
 #include "CoreFS/CoreFS.h"
 #include "CoreFile/CoreFile.h"
 #include "CoreString/CoreString.h"
+// CoreIni
+#include "../include/IniWriter.h"
+#include "../include/ValueReader.h"
+#include "CoreIni_Private.h"
 
 // Usings
 USING_NS_COREINI;
 
 
 //----------------------------------------------------------------------------//
-// Macros                                                                     //
+// Helpers                                                                    //
 //----------------------------------------------------------------------------//
-#define INI_THROW_IF(_cond_, _exception_, _fmt_, ...)                     \
-    do {                                                                  \
-        if((_cond_))                                                     \
-            throw _exception_(CoreString::Format(_fmt_,  ##__VA_ARGS__)); \
-    } while(0)
+namespace {
+
+inline bool IsBlank(char c) noexcept
+{
+    return c == ' ' || c == '\t' || c == '\r' || c == '\n';
+}
+
+inline std::string_view TrimView(std::string_view str) noexcept
+{
+    auto begin = size_t(0);
+    auto end   = str.size();
+    while(begin < end && IsBlank(str[begin  ])) ++begin;
+    while(end > begin && IsBlank(str[end - 1])) --end;
+
+    return str.substr(begin, end - begin);
+}
+
+// Char after a backslash on a quoted content -> Char that it stands for.
+// The same escapes written by IniWriter - 0 for the unknown ones.
+inline char Unescape(char c) noexcept
+{
+    switch(c)
+    {
+        case '"' : return '"';
+        case '\\': return '\\';
+        case 'n' : return '\n';
+        case 'r' : return '\r';
+        case 't' : return '\t';
+    }
+
+    return 0;
+}
+
+// Column of a char of the line - 1 based, as the line numbers.
+inline size_t ColumnOf(const std::string &line, const char *pChar) noexcept
+{
+    return size_t(pChar - line.data()) + 1;
+}
+
+// Copies the first content of a value - Without joining continued values.
+inline std::string ReadContent(const Value &value)
+{
+    auto reader  = ValueReader(value);
+    auto content = std::string(reader.GetSize(), '\0');
+    reader.Read(&content[0], content.size());
+
+    return content;
+}
+
+} // anonymous namespace
 
 
 //----------------------------------------------------------------------------//
@@ -57,16 +109,19 @@ const char* Section::kGlobalName = "CoreIni::Global::Section";
 Ini::Ini(
     const std::string &filename,
     uint8_t            commentType,          /* = INI_COMMENT_DEFAULT    */
-    uint8_t            sectionDuplicateMode, /* = INI_DUPLICATE_DISALLOW */
-    uint8_t            valueDuplicateMode,   /* = INI_DUPLICATE_DISALLOW */
+    uint8_t            sectionDuplicateMode, /* = INI_DUPLICATE_IGNORE   */
+    uint8_t            valueDuplicateMode,   /* = INI_DUPLICATE_IGNORE   */
     bool               allowQuoted,          /* = true                   */
     bool               allowBackslashes,     /* = true                   */
     bool               allowGlobals,         /* = true                   */
     bool               allowHierarchy,       /* = true                   */
     char               hierarchyDelimiter,   /* = '/'                    */
-    char               keyValueDelimiter)    /* = '='                    */
+    char               keyValueDelimiter,    /* = '='                    */
+    bool               caseInsensitive,      /* = false                  */
+    uint8_t            parseMode)            /* = INI_PARSE_STRICT       */
     // Members
-    : m_commentType         (         commentType)
+    : m_contentHash         (                   0)
+    , m_commentType         (         commentType)
     , m_sectionDuplicateMode(sectionDuplicateMode)
     , m_valueDuplicateMode  (  valueDuplicateMode)
     , m_allowQuoted         (         allowQuoted)
@@ -75,6 +130,10 @@ Ini::Ini(
     , m_allowHierarchy      (      allowHierarchy)
     , m_hierarchyDelimiter  (  hierarchyDelimiter)
     , m_keyValueDelimiter   (   keyValueDelimiter)
+    , m_caseInsensitive     (     caseInsensitive)
+    , m_parseMode           (           parseMode)
+    , m_interpolationEnabled(               false)
+    , m_profilingEnabled    (               false)
 {
     //--------------------------------------------------------------------------
     // Sanity checks...
@@ -92,16 +151,18 @@ Ini::Ini(
 
 Ini::Ini(
     uint8_t            commentType,          /* = INI_COMMENT_DEFAULT    */
-    uint8_t            sectionDuplicateMode, /* = INI_DUPLICATE_DISALLOW */
-    uint8_t            valueDuplicateMode,   /* = INI_DUPLICATE_DISALLOW */
+    uint8_t            sectionDuplicateMode, /* = INI_DUPLICATE_IGNORE   */
+    uint8_t            valueDuplicateMode,   /* = INI_DUPLICATE_IGNORE   */
     bool               allowQuoted,          /* = true                   */
     bool               allowBackslashes,     /* = true                   */
     bool               allowGlobals,         /* = true                   */
     bool               allowHierarchy,       /* = true                   */
     char               hierarchyDelimiter,   /* = '/'                    */
-    char               keyValueDelimiter)    /* = '='                    */
+    char               keyValueDelimiter,    /* = '='                    */
+    bool               caseInsensitive)      /* = false                  */
     // Members
-    : m_commentType         (         commentType)
+    : m_contentHash         (                   0)
+    , m_commentType         (         commentType)
     , m_sectionDuplicateMode(sectionDuplicateMode)
     , m_valueDuplicateMode  (  valueDuplicateMode)
     , m_allowQuoted         (         allowQuoted)
@@ -110,29 +171,50 @@ Ini::Ini(
     , m_allowHierarchy      (      allowHierarchy)
     , m_hierarchyDelimiter  (  hierarchyDelimiter)
     , m_keyValueDelimiter   (   keyValueDelimiter)
+    , m_caseInsensitive     (     caseInsensitive)
+    , m_parseMode           (    INI_PARSE_STRICT)
+    , m_interpolationEnabled(               false)
+    , m_profilingEnabled    (               false)
 {
     // Empty...
 }
 
 void Ini::Save(const std::string &path)
 {
-    std::stringstream ss;
+    IniWriter writer(CoreFS::ExpandUserAndMakeAbs(path), m_keyValueDelimiter);
+
+    //--------------------------------------------------------------------------
+    // Global values must be written before any section.
+    auto p_global = FindSection(Section::kGlobalName, HashName(Section::kGlobalName));
+    if(p_global)
+    {
+        for(const auto &value : p_global->m_values)
+        {
+            for(size_t i = 0; i < value.GetContentsCount(); ++i)
+            {
+                auto reader = ValueReader(value, i);
+                writer.WriteValue(value.m_name, reader);
+            }
+        }
+    }
+
     for(const auto &section : m_sections)
     {
-        ss << CoreString::Format("[%s]\n", section.m_name);
+        if(&section == p_global)
+            continue;
+
+        writer.WriteSection(section.m_name);
         for(const auto &value : section.m_values)
         {
-            ss << CoreString::Format(
-                "    %s %c %s\n",
-                value.m_name,
-                m_keyValueDelimiter,
-                value.m_content
-            );
+            for(size_t i = 0; i < value.GetContentsCount(); ++i)
+            {
+                auto reader = ValueReader(value, i);
+                writer.WriteValue(value.m_name, reader);
+            }
         }
-        ss << "\n";
     }
 
-    CoreFile::WriteAllText(CoreFS::ExpandUserAndMakeAbs(path), ss.str());
+    writer.Close();
 }
 
 
@@ -145,13 +227,13 @@ void Ini::AddSection(const std::string &sectionName)
 
     //--------------------------------------------------------------------------
     // Ignore Mode - Just return if already exists.
-    if(section_exists && ACOW_FLAG_HAS(INI_DUPLICATE_IGNORE, m_sectionDuplicateMode))
+    if(section_exists && m_sectionDuplicateMode == INI_DUPLICATE_IGNORE)
         return;
 
     //--------------------------------------------------------------------------
     // Disallow mode - Always throw if section exits..
     INI_THROW_IF(
-        section_exists && ACOW_FLAG_HAS(INI_DUPLICATE_DISALLOW, m_sectionDuplicateMode),
+        section_exists && m_sectionDuplicateMode == INI_DUPLICATE_DISALLOW,
         std::invalid_argument,
         "Section: (%s) already exists.",
         sectionName.c_str()
@@ -159,16 +241,26 @@ void Ini::AddSection(const std::string &sectionName)
 
     //--------------------------------------------------------------------------
     // Overwrite mode - Clear previous or add a new if needed.
-    if(ACOW_FLAG_HAS(INI_DUPLICATE_OVERWRITE, m_sectionDuplicateMode))
+    if(m_sectionDuplicateMode == INI_DUPLICATE_OVERWRITE)
     {
         if(section_exists)
         {
-            auto &section = GetSection(sectionName);
-            const_cast<Section &>(section).m_values.clear();
+            auto &section = const_cast<Section &>(LookupSection(sectionName));
+            InvalidateInterpolation(section);
+
+            //------------------------------------------------------------------
+            // Back to the hash of an empty section.
+            SetSectionContentHash(section, Hash::Mix(section.m_hash));
+
+            EraseAccessCounts(section);
+            section.m_values     .clear();
+            section.m_valuesIndex.clear();
+            m_pinnedValues       .clear();
+            DropFinalIndex();
         }
         else
         {
-            m_sections.push_back(Section(sectionName));
+            InsertSection(sectionName);
         }
 
         return;
@@ -176,15 +268,15 @@ void Ini::AddSection(const std::string &sectionName)
 
     //--------------------------------------------------------------------------
     // Merge mode - But section.
-    if(ACOW_FLAG_HAS(INI_DUPLICATE_MERGE, m_sectionDuplicateMode))
+    if(m_sectionDuplicateMode == INI_DUPLICATE_MERGE)
     {
         if(!section_exists)
-            m_sections.push_back(Section(sectionName));
+            InsertSection(sectionName);
 
         return;
     }
 
-    m_sections.push_back(Section(sectionName));
+    InsertSection(sectionName);
 }
 
 
@@ -194,21 +286,35 @@ void Ini::AddSection(const std::string &sectionName)
 void Ini::RemoveSection(const std::string &name)
 {
     INI_THROW_IF(
-        SectionExists(name),
+        !SectionExists(name),
         std::invalid_argument,
         "Section: (%s) doesn't exists",
         name.c_str()
     );
 
-    m_sections.erase(std::remove_if(
-        std::begin(m_sections),
-        std::end  (m_sections),
-        [&name](const Section &s) {
-            return s.m_name == name;
-        }
-    ));
-}
+    InvalidateInterpolation(LookupSection(name));
+    EraseAccessCounts(LookupSection(name));
+    m_sectionAccessCounts.erase(LookupSection(name).m_hash);
+    m_pinnedSections.clear();
+    m_pinnedValues  .clear();
+    m_contentHash -= Hash::Mix(LookupSection(name).m_contentHash);
+
+    auto hash = HashName(name);
+    m_sections.erase(
+        std::remove_if(
+            std::begin(m_sections),
+            std::end  (m_sections),
+            [this, &name, hash](const Section &s) {
+                return s.m_hash == hash && NamesEqual(s.m_name, name);
+            }
+        ),
+        std::end(m_sections)
+    );
 
+    //--------------------------------------------------------------------------
+    // The indexes of the sections after the removed one had changed.
+    RebuildSectionsIndex();
+}
 
 
 //----------------------------------------------------------------------------//
@@ -216,22 +322,11 @@ void Ini::RemoveSection(const std::string &name)
 //----------------------------------------------------------------------------//
 const Section& Ini::GetSection(const std::string &path) const
 {
-    auto it = std::find_if(
-        std::begin(m_sections),
-        std::end  (m_sections),
-        [&path](const Section &section) {
-            return section.m_name == path;
-        }
-    );
-
-    INI_THROW_IF(
-        it == std::end(m_sections),
-        std::invalid_argument,
-        "Section doesn't exists - path: (%s)",
-        path.c_str()
-    );
+    auto &section = LookupSection(path);
+    if(m_profilingEnabled)
+        CountAccess(section, nullptr);
 
-    return *it;
+    return section;
 }
 
 const std::vector<Section>& Ini::GetSections() const noexcept
@@ -260,15 +355,7 @@ std::vector<std::string> Ini::GetSectionNames() const noexcept
 
 bool Ini::SectionExists(const std::string &path) const noexcept
 {
-    auto it = std::find_if(
-        std::begin(m_sections),
-        std::end  (m_sections),
-        [&path](const Section &section) {
-            return section.m_name == path;
-        }
-    );
-
-    return it != std::end(m_sections);
+    return FindSection(path, HashName(path)) != nullptr;
 }
 
 //----------------------------------------------------------------------------//
@@ -283,31 +370,47 @@ void Ini::AddValue(
 
     //--------------------------------------------------------------------------
     // Ignore mode - Just return if needed.
-    if(value_exists && ACOW_FLAG_HAS(INI_DUPLICATE_IGNORE, m_valueDuplicateMode))
+    if(value_exists && m_valueDuplicateMode == INI_DUPLICATE_IGNORE)
         return;
 
     //--------------------------------------------------------------------------
     // Disallow mode - Always throws if needed.
     INI_THROW_IF(
-        value_exists && ACOW_FLAG_HAS(INI_DUPLICATE_DISALLOW, m_valueDuplicateMode),
+        value_exists && m_valueDuplicateMode == INI_DUPLICATE_DISALLOW,
         std::invalid_argument,
         "Section: (%s)'s Value: (%s) already exists.",
         sectionName.c_str(),
         valueName  .c_str()
     );
 
+    //--------------------------------------------------------------------------
+    // Merge mode - Keep all the contents.
+    if(value_exists && m_valueDuplicateMode == INI_DUPLICATE_MERGE)
+    {
+        auto  p_section = static_cast<const Section *>(nullptr);
+        auto &value     = LookupValue(sectionName, valueName, &p_section);
+        AppendContent(
+            *const_cast<Section *>(p_section),
+            const_cast<Value &>(value),
+            valueContent
+        );
+    }
     //--------------------------------------------------------------------------
     // Overwrite Mode.
-    if(value_exists)
+    else if(value_exists)
     {
-        auto &value = GetValue(sectionName, valueName);
-        const_cast<Value &>(value).m_content = valueContent;
+        auto  p_section = static_cast<const Section *>(nullptr);
+        auto &value     = LookupValue(sectionName, valueName, &p_section);
+        OverwriteContent(
+            *const_cast<Section *>(p_section),
+            const_cast<Value &>(value),
+            valueContent
+        );
     }
     else
     {
-        const_cast<Section &>(
-            GetSection(sectionName)
-        ).m_values.push_back(Value(valueName, valueContent));
+        auto &section = const_cast<Section &>(LookupSection(sectionName));
+        InsertValue(section, valueName, valueContent);
     }
 }
 
@@ -329,17 +432,31 @@ void Ini::RemoveValue(
         valueName  .c_str()
     );
 
-    auto &section = GetSection(sectionName);
-    auto &values  = const_cast<Section &>(section).m_values;
+    auto &section = const_cast<Section &>(LookupSection(sectionName));
+    auto &values  = section.m_values;
+    auto  hash    = HashName(valueName);
+
+    auto &value = LookupValue(sectionName, valueName, nullptr);
+    InvalidateInterpolation(section, value);
+    m_valueAccessCounts.erase(Hash::Combine(section.m_hash, value.m_hash));
+    m_pinnedValues.clear();
+
+    SetSectionContentHash(section, section.m_contentHash - value.GetContentHash());
+
     values.erase(
         std::remove_if(
             std::begin(values),
             std::end  (values),
-            [&valueName](const Value &v) {
-                return v.m_name == valueName;
+            [this, &valueName, hash](const Value &v) {
+                return v.m_hash == hash && NamesEqual(v.m_name, valueName);
             }
-        )
+        ),
+        std::end(values)
     );
+
+    //--------------------------------------------------------------------------
+    // The indexes of the values after the removed one had changed.
+    RebuildValuesIndex(section);
 }
 
 
@@ -350,26 +467,13 @@ const Value& Ini::GetValue(
     const std::string &sectionName,
     const std::string &valueName) const
 {
-    auto &section = GetSection(sectionName);
-    auto &values  = section.GetValues();
-
-    auto it = std::find_if(
-        std::begin(values),
-        std::end  (values),
-        [&valueName](const Value &v) {
-            return v.m_name == valueName;
-        }
-    );
+    auto  p_section = static_cast<const Section *>(nullptr);
+    auto &value     = LookupValue(sectionName, valueName, &p_section);
 
-    INI_THROW_IF(
-        it == std::end(values),
-        std::invalid_argument,
-        "Section (%s) - Value (%s) doesn't exists.",
-        sectionName.c_str(),
-        valueName  .c_str()
-    );
+    if(m_profilingEnabled)
+        CountAccess(*p_section, &value);
 
-    return *it;
+    return value;
 }
 
 
@@ -377,231 +481,1005 @@ bool Ini::ValueExists(
     const std::string &sectionName,
     const std::string &valueName) const noexcept
 {
+    auto section_hash = HashName(sectionName);
+    auto value_hash   = HashName(valueName  );
+
+    //--------------------------------------------------------------------------
+    // Finalized - Every value is on the table.
+    if(IsFinalized())
+    {
+        return FindFinalValue(
+            sectionName, section_hash,
+            valueName,   value_hash,
+            nullptr
+        ) != nullptr;
+    }
+
     //--------------------------------------------------------------------------
     // Section doesn't exists, so the value.
-    if(!SectionExists(sectionName))
+    auto p_section = FindSection(sectionName, section_hash);
+    if(!p_section)
         return false;
 
-    auto &section = GetSection(sectionName);
-    auto &values  = section.GetValues();
-
-    auto it = std::find_if(
-        std::begin(values),
-        std::end  (values),
-        [&valueName](const Value &v) {
-            return v.m_name == valueName;
-        }
-    );
+    return FindValue(*p_section, valueName, value_hash) != nullptr;
+}
 
-    return it != std::end(values);
+ValueContents Ini::GetValues(
+    const std::string &sectionName,
+    const std::string &valueName) const
+{
+    return ValueContents(GetValue(sectionName, valueName));
 }
 
+
 //----------------------------------------------------------------------------//
-// Private Methods                                                            //
+// Interpolation                                                              //
 //----------------------------------------------------------------------------//
-void Ini::Parse(const std::vector<std::string> &lines)
+void Ini::SetInterpolationEnabled(bool enabled) noexcept
 {
-    auto clean_lines = std::vector<std::string>();
-    clean_lines.reserve(lines.size());
+    m_interpolationEnabled = enabled;
+}
 
-    Section *p_curr_section = nullptr;
-    auto section_name = std::string();
-    auto key_value    = std::vector<std::string>();
+bool Ini::IsInterpolationEnabled() const noexcept
+{
+    return m_interpolationEnabled;
+}
 
-    for(const auto &line : lines)
-    {
-        //----------------------------------------------------------------------
-        // Empty or comments... - Ignore those.
-        if(IsCommentLine(line))
-            continue;
-        if(CoreString::IsNullOrWhiteSpace(line))
-            continue;
+const std::string& Ini::GetInterpolatedContent(
+    const std::string &sectionName,
+    const std::string &valueName) const
+{
+    auto  p_section = static_cast<const Section *>(nullptr);
+    auto &value     = LookupValue(sectionName, valueName, &p_section);
 
-        //----------------------------------------------------------------------
-        // Section.
-        if(IsSectionLine(line, &section_name))
-        {
-            if(SectionExists(section_name))
-            {
-                p_curr_section = const_cast<Section *>(&GetSection(section_name));
-            }
-            else
-            {
-                auto section = Section(section_name);
+    if(m_profilingEnabled)
+        CountAccess(*p_section, &value);
 
-                m_sections.push_back(section);
-                p_curr_section = &m_sections.back();
-            }
+    return Interpolate(*p_section, value);
+}
 
-            continue;
-        }
 
-        //----------------------------------------------------------------------
-        // Value
-        if(IsValueLine(line, &key_value))
-        {
-            //------------------------------------------------------------------
-            // We're dealing with a global value and we allow globals values,
-            // but haven't yet a global section, so let's create it.
-            if(m_allowGlobals && !p_curr_section)
-            {
-                auto global_section = Section(Section::kGlobalName);
+//----------------------------------------------------------------------------//
+// Profiling                                                                  //
+//----------------------------------------------------------------------------//
+void Ini::SetProfilingEnabled(bool enabled) noexcept
+{
+    m_profilingEnabled = enabled;
+}
 
-                m_sections.push_back(global_section);
-                p_curr_section = &m_sections.back();
-            }
-            //------------------------------------------------------------------
-            // We're dealing with a global value, but we don't allow it.
-            else if(!m_allowGlobals && !p_curr_section)
-            {
-                auto msg = CoreString::Format(
-                    "Found a global value but CoreIni is set to not allow them - Line: (%s)",
-                    line
-                );
+bool Ini::IsProfilingEnabled() const noexcept
+{
+    return m_profilingEnabled;
+}
 
-                throw std::logic_error(msg);
-            }
+void Ini::ResetAccessCounts() noexcept
+{
+    m_sectionAccessCounts.clear();
+    m_valueAccessCounts  .clear();
+}
 
-            auto exists = ValueExists(p_curr_section->m_name, key_value[0]);
-            //------------------------------------------------------------------
-            // Disallow any duplicates.
-            if(exists && ACOW_FLAG_HAS(INI_DUPLICATE_DISALLOW, m_valueDuplicateMode))
-            {
-                auto msg = CoreString::Format(
-                    "Value is duplicated but CoreIni is set to not allow them - Line: (%s)",
-                    line
-                );
+std::vector<Ini::AccessCount> Ini::GetMostAccessedSections(size_t count) const
+{
+    auto counts = std::vector<AccessCount>();
+    counts.reserve(m_sections.size());
 
-                throw std::logic_error(msg);
-            }
-            //------------------------------------------------------------------
-            // Ignore any duplicates.
-            else if(exists && ACOW_FLAG_HAS(INI_DUPLICATE_IGNORE, m_valueDuplicateMode))
-            {
-                // Just ignore...
-                continue;
-            }
-            //------------------------------------------------------------------
-            // Overwrite any duplicates.
-            else if(exists && ACOW_FLAG_HAS(INI_DUPLICATE_OVERWRITE, m_valueDuplicateMode))
-            {
-                auto &value = GetValue(section_name, key_value[0]);
-                const_cast<Value &>(value).m_content = key_value[1];
-            }
-            //------------------------------------------------------------------
-            // Doesn't exits, just add.
-            else
-            {
-                auto val = Value(key_value[0], key_value[1]);
-                p_curr_section->m_values.push_back(val);
-            }
+    for(const auto &section : m_sections)
+    {
+        auto it = m_sectionAccessCounts.find(section.m_hash);
+        if(it != m_sectionAccessCounts.end())
+            counts.push_back({section.m_name, "", it->second});
+    }
 
-            continue;
-        } // if(IsValueLine(line, &key_value))
-    } // for(const auto &line : lines)
+    return SortAccessCounts(std::move(counts), count);
 }
 
-bool Ini::IsCommentLine(const std::string &line) const noexcept
+std::vector<Ini::AccessCount> Ini::GetMostAccessedValues(size_t count) const
 {
-    //--------------------------------------------------------------------------
-    // Empty lines aren't considered comments.
-    if(line.empty())
-        return false;
+    auto counts = std::vector<AccessCount>();
+    for(const auto &section : m_sections)
+    {
+        for(const auto &value : section.m_values)
+        {
+            auto it = m_valueAccessCounts.find(Hash::Combine(section.m_hash, value.m_hash));
+            if(it != m_valueAccessCounts.end())
+                counts.push_back({section.m_name, value.m_name, it->second});
+        }
+    }
 
-    //--------------------------------------------------------------------------
-    // We don't care for leading empty chars.
-    auto clean = CoreString::TrimStart(line);
-    if(clean.empty())
-        return false;
+    return SortAccessCounts(std::move(counts), count);
+}
 
-    //--------------------------------------------------------------------------
-    // Semicolon ;
-    if(clean.front() == ';' && ACOW_FLAG_HAS(INI_COMMENT_SEMICOLON, m_commentType))
-        return true;
+void Ini::PinMostAccessedSections(size_t count)
+{
+    m_pinnedSections.clear();
 
     //--------------------------------------------------------------------------
-    // Hash #
-    if(clean.front() == '#' && ACOW_FLAG_HAS(INI_COMMENT_HASH, m_commentType))
-        return true;
+    // The table is scanned linearly, it must stay small.
+    count = std::min(count, kMaxPinnedSections);
 
-    // COWTODO(n2omatt): What we gonna do with INI_COMMENT_NONE???
+    for(size_t i = 0; i < m_sections.size(); ++i)
+    {
+        const auto &section = m_sections[i];
 
-    return false;
+        auto it = m_sectionAccessCounts.find(section.m_hash);
+        if(it == m_sectionAccessCounts.end())
+            continue;
+
+        m_pinnedSections.push_back({section.m_hash, it->second, uint32_t(i)});
+    }
+
+    auto middle = m_pinnedSections.begin() + std::min(count, m_pinnedSections.size());
+    std::partial_sort(
+        std::begin(m_pinnedSections),
+        middle,
+        std::end  (m_pinnedSections),
+        [](const PinnedSection &lhs, const PinnedSection &rhs) {
+            return lhs.accessCount > rhs.accessCount;
+        }
+    );
+
+    m_pinnedSections.erase(middle, std::end(m_pinnedSections));
+    m_pinnedSections.shrink_to_fit();
 }
 
-bool Ini::IsSectionLine(
-    const std::string &line,
-    std::string       *pOut_SectionName) const noexcept
+void Ini::UnpinSections() noexcept
 {
-    COREASSERT_ASSERT(pOut_SectionName, "pOut_SectionName can't be nullptr");
+    m_pinnedSections.clear();
+}
 
-    //COWTODO(n2omatt): Use regex???
-    auto clean_name  = CoreString::Trim(StripComments(line));
+void Ini::PinMostAccessedValues(size_t count)
+{
+    m_pinnedValues.clear();
 
     //--------------------------------------------------------------------------
-    // Empty string - Can't be section name.
-    if(clean_name.empty())
-        return false;
+    // The table is scanned linearly, it must stay small.
+    count = std::min(count, kMaxPinnedValues);
 
-    //--------------------------------------------------------------------------
-    // Section name must be inside brackets [, ]
-    if(clean_name.front() == '[' && clean_name.back() == ']')
+    for(size_t i = 0; i < m_sections.size(); ++i)
     {
-        *pOut_SectionName = std::string(
-            std::begin(clean_name) +1,
-            std::end  (clean_name) -1
-        );
-        return true;
+        const auto &section = m_sections[i];
+        for(size_t j = 0; j < section.m_values.size(); ++j)
+        {
+            const auto &value = section.m_values[j];
+            auto        hash  = Hash::Combine(section.m_hash, value.m_hash);
+
+            auto it = m_valueAccessCounts.find(hash);
+            if(it == m_valueAccessCounts.end())
+                continue;
+
+            m_pinnedValues.push_back({hash, it->second, uint32_t(i), uint32_t(j)});
+        }
     }
 
-    //--------------------------------------------------------------------------
-    // Doesn't matches the requirement of be inside brackets [, ]
-    return false;
+    auto middle = m_pinnedValues.begin() + std::min(count, m_pinnedValues.size());
+    std::partial_sort(
+        std::begin(m_pinnedValues),
+        middle,
+        std::end  (m_pinnedValues),
+        [](const PinnedValue &lhs, const PinnedValue &rhs) {
+            return lhs.accessCount > rhs.accessCount;
+        }
+    );
+
+    m_pinnedValues.erase(middle, std::end(m_pinnedValues));
+    m_pinnedValues.shrink_to_fit();
 }
 
-bool Ini::IsValueLine(
-    const std::string        &line,
-    std::vector<std::string> *pOut_KeyVal) const noexcept
+void Ini::UnpinValues() noexcept
 {
-    COREASSERT_ASSERT(pOut_KeyVal, "pOut_KeyVal can't be nullptr");
-
-    //COWTODO(n2omatt): Use regex???
-    auto clean_line = CoreString::Trim(StripComments(line));
+    m_pinnedValues.clear();
+}
 
-    if(clean_line.empty())
-        return false;
 
-    auto key_val = CoreString::Split(
-        clean_line,
-        m_keyValueDelimiter
-    );
+//----------------------------------------------------------------------------//
+// Finalize                                                                   //
+//----------------------------------------------------------------------------//
+bool Ini::Finalize()
+{
+    DropFinalIndex();
 
     //--------------------------------------------------------------------------
-    // A property must be of size 2.
-    if(key_val.size() != 2)
+    // Gather the pairs - Equal hashes can't be told apart by any
+    // displacement, so we give up on them.
+    auto entries = std::vector<FinalEntry>();
+    for(size_t i = 0; i < m_sections.size(); ++i)
+    {
+        const auto &section = m_sections[i];
+        for(size_t j = 0; j < section.m_values.size(); ++j)
+        {
+            entries.push_back({
+                Hash::Combine(section.m_hash, section.m_values[j].m_hash),
+                uint32_t(i),
+                uint32_t(j)
+            });
+        }
+    }
+
+    if(entries.empty())
         return false;
 
-    auto key   = CoreString::Trim(key_val[0]);
-    auto value = CoreString::Trim(key_val[1]);
+    auto sorted_hashes = std::vector<uint64_t>();
+    sorted_hashes.reserve(entries.size());
+    for(const auto &entry : entries)
+        sorted_hashes.push_back(entry.hash);
 
-    //--------------------------------------------------------------------------
-    // We must have both components of the property.
-    if(key.empty() || value.empty())
+    std::sort(std::begin(sorted_hashes), std::end(sorted_hashes));
+    if(std::adjacent_find(std::begin(sorted_hashes), std::end(sorted_hashes)) != std::end(sorted_hashes))
         return false;
 
     //--------------------------------------------------------------------------
-    // Make sure that we have the correct size.
-    if(pOut_KeyVal->size() != 2)
-        pOut_KeyVal->resize(2);
-
+    // Hash and displace:
+    //   The pairs are split in small buckets, then starting by the biggest
+    //   bucket we search a displacement that puts all its pairs on free
+    //   slots - The lookup only needs the displacement of the bucket.
+    const auto size          = entries.size();
+    const auto buckets_count = size / 2 + 1;
+
+    auto buckets = std::vector<std::vector<uint32_t>>(buckets_count);
+    for(size_t i = 0; i < size; ++i)
+        buckets[Hash::Mix(entries[i].hash) % buckets_count].push_back(uint32_t(i));
+
+    auto order = std::vector<uint32_t>(buckets_count);
+    for(size_t i = 0; i < buckets_count; ++i)
+        order[i] = uint32_t(i);
+
+    std::stable_sort(
+        std::begin(order),
+        std::end  (order),
+        [&buckets](uint32_t lhs, uint32_t rhs) {
+            return buckets[lhs].size() > buckets[rhs].size();
+        }
+    );
+
+    constexpr auto kMaxDisplacement = uint32_t(1) << 24;
+
+    auto displacements = std::vector<uint32_t>  (buckets_count, 0);
+    auto table         = std::vector<FinalEntry>(size);
+    auto taken         = std::vector<bool>      (size, false);
+    auto slots         = std::vector<size_t>();
+
+    for(auto bucket_index : order)
+    {
+        const auto &bucket = buckets[bucket_index];
+        if(bucket.empty())
+            break;
+
+        auto placed = false;
+        for(uint32_t d = 0; d < kMaxDisplacement && !placed; ++d)
+        {
+            slots.clear();
+            placed = true;
+
+            for(auto entry_index : bucket)
+            {
+                auto slot = FinalSlot(entries[entry_index].hash, d, size);
+                if(taken[slot] || std::find(std::begin(slots), std::end(slots), slot) != std::end(slots))
+                {
+                    placed = false;
+                    break;
+                }
+
+                slots.push_back(slot);
+            }
+
+            if(!placed)
+                continue;
+
+            displacements[bucket_index] = d;
+            for(size_t i = 0; i < bucket.size(); ++i)
+            {
+                taken[slots[i]] = true;
+                table[slots[i]] = entries[bucket[i]];
+            }
+        }
+
+        if(!placed)
+            return false;
+    }
+
+    m_finalDisplacements = std::move(displacements);
+    m_finalEntries       = std::move(table);
+
+    //--------------------------------------------------------------------------
+    // The table replaces the values indexes - They're rebuilt by the first
+    // change that drops it.
+    for(auto &section : m_sections)
+        decltype(section.m_valuesIndex)().swap(section.m_valuesIndex);
+
+    return true;
+}
+
+bool Ini::IsFinalized() const noexcept
+{
+    return !m_finalEntries.empty();
+}
+
+
+//----------------------------------------------------------------------------//
+// Merge                                                                      //
+//----------------------------------------------------------------------------//
+void Ini::Merge(
+    const Ini &other,
+    uint8_t    duplicateMode /* = INI_DUPLICATE_OVERWRITE */)
+{
+    MergeImpl(other, duplicateMode);
+}
+
+void Ini::Merge(
+    Ini     &&other,
+    uint8_t   duplicateMode /* = INI_DUPLICATE_OVERWRITE */)
+{
+    MergeImpl(std::move(other), duplicateMode);
+}
+
+
+//----------------------------------------------------------------------------//
+// Private Methods                                                            //
+//----------------------------------------------------------------------------//
+template <typename TIni>
+void Ini::MergeImpl(TIni &&other, uint8_t duplicateMode)
+{
+    //--------------------------------------------------------------------------
+    // Strings of a const Ini are copied, of a rvalue Ini are moved.
+    using StringRef_t = typename std::conditional<
+        std::is_const<typename std::remove_reference<TIni>::type>::value,
+        const std::string &,
+        std::string &&
+    >::type;
+
+    //--------------------------------------------------------------------------
+    // Merging with itself - The loops below would append to the contents
+    // and the values that they're going through, so merge a copy.
+    if(static_cast<const void *>(&other) == this)
+    {
+        MergeImpl(Ini(other), duplicateMode);
+        return;
+    }
+
+    //--------------------------------------------------------------------------
+    // The hashes of other can be reused if both Inis fold the names the same.
+    auto same_hashing = (m_caseInsensitive == other.m_caseInsensitive);
+    auto hash_of = [this, same_hashing](uint64_t hash, const std::string &name) {
+        return (same_hashing) ? hash : HashName(name);
+    };
+
+    //--------------------------------------------------------------------------
+    // Disallow mode - Check everything before, so we don't merge partially.
+    if(duplicateMode == INI_DUPLICATE_DISALLOW)
+    {
+        for(const auto &other_section : other.m_sections)
+        {
+            auto p_section = FindSection(
+                other_section.m_name,
+                hash_of(other_section.m_hash, other_section.m_name)
+            );
+            if(!p_section)
+                continue;
+
+            for(const auto &other_value : other_section.m_values)
+            {
+                auto p_value = FindValue(
+                    *p_section,
+                    other_value.m_name,
+                    hash_of(other_value.m_hash, other_value.m_name)
+                );
+
+                INI_THROW_IF(
+                    p_value,
+                    std::invalid_argument,
+                    "Section: (%s)'s Value: (%s) already exists.",
+                    other_section.m_name.c_str(),
+                    other_value  .m_name.c_str()
+                );
+            }
+        }
+    }
+
+    for(auto &other_section : other.m_sections)
+    {
+        auto p_section = const_cast<Section *>(FindSection(
+            other_section.m_name,
+            hash_of(other_section.m_hash, other_section.m_name)
+        ));
+
+        if(!p_section)
+            p_section = &InsertSection(static_cast<StringRef_t>(other_section.m_name));
+
+        for(auto &other_value : other_section.m_values)
+        {
+            auto p_value = const_cast<Value *>(FindValue(
+                *p_section,
+                other_value.m_name,
+                hash_of(other_value.m_hash, other_value.m_name)
+            ));
+
+            //------------------------------------------------------------------
+            // Ignore mode - Keep what we have.
+            if(p_value && duplicateMode == INI_DUPLICATE_IGNORE)
+                continue;
+
+            //------------------------------------------------------------------
+            // Add a new one, or overwrite the first content - The remaining
+            // are appended below, so merge mode keep the current contents.
+            //   Continued values share their pieces instead of being joined,
+            // unless they're appended to another value.
+            if(!p_value)
+            {
+                p_value = &InsertValue(
+                    *p_section,
+                    static_cast<StringRef_t>(other_value.m_name   ),
+                    static_cast<StringRef_t>(other_value.m_content)
+                );
+                if(other_value.m_pContinuation)
+                    SetContinuation(*p_section, *p_value, other_value.m_pContinuation);
+            }
+            else if(duplicateMode == INI_DUPLICATE_MERGE)
+            {
+                AppendContent(
+                    *p_section,
+                    *p_value,
+                    (other_value.m_pContinuation)
+                        ? ReadContent(other_value)
+                        : static_cast<StringRef_t>(other_value.m_content)
+                );
+            }
+            else
+            {
+                OverwriteContent(
+                    *p_section,
+                    *p_value,
+                    static_cast<StringRef_t>(other_value.m_content)
+                );
+                if(other_value.m_pContinuation)
+                    SetContinuation(*p_section, *p_value, other_value.m_pContinuation);
+            }
+
+            for(auto &content : other_value.m_moreContents)
+                AppendContent(*p_section, *p_value, static_cast<StringRef_t>(content));
+        }
+    }
+}
+
+void Ini::Parse(const std::vector<std::string> &lines)
+{
+    m_diagnostics.clear();
+
+    Section *p_curr_section = nullptr;
+    auto section_name = std::string();
+    auto value_name   = std::string_view();
+    auto content      = std::string_view();
+    auto unescaped    = std::string();
+    auto quoted       = false;
+    auto segments     = std::vector<std::string_view>();
+    // Their pieces point to lines until the end of the parse.
+    auto continuations = std::vector<std::shared_ptr<Value::Continuation>>();
+
+    for(size_t i = 0; i < lines.size(); ++i)
+    {
+        const auto &line        = lines[i];
+        const auto  line_number = i + 1;
+
+        //----------------------------------------------------------------------
+        // Empty or comments... - Ignore those.
+        if(IsCommentLine(line))
+            continue;
+        if(CoreString::IsNullOrWhiteSpace(line))
+            continue;
+
+        //----------------------------------------------------------------------
+        // Section - Only lines starting with [ can be one.
+        auto first_char = line.find_first_not_of(" \t\r\n");
+        if(line[first_char] == '[' && IsSectionLine(line, &section_name))
+        {
+            p_curr_section = const_cast<Section *>(
+                FindSection(section_name, HashName(section_name))
+            );
+
+            if(!p_curr_section)
+            {
+                p_curr_section = &InsertSection(section_name);
+                p_curr_section->m_lineNumber = line_number;
+            }
+
+            continue;
+        }
+
+        //----------------------------------------------------------------------
+        // Value
+        if(IsValueLine(line, &value_name, &content, &unescaped, &quoted))
+        {
+            //------------------------------------------------------------------
+            // Continued value - Consume the next lines even if the value
+            // is going to be ignored, so they aren't parsed on their own.
+            segments.clear();
+            if(m_allowBackslashes && !quoted && content.back() == '\\')
+                ReadContinuation(lines, &i, content, &segments);
+
+            //------------------------------------------------------------------
+            // We're dealing with a global value and we allow globals values,
+            // but haven't yet a global section, so let's create it.
+            if(m_allowGlobals && !p_curr_section)
+            {
+                p_curr_section = &InsertSection(Section::kGlobalName);
+                p_curr_section->m_lineNumber = line_number;
+            }
+            //------------------------------------------------------------------
+            // We're dealing with a global value, but we don't allow it.
+            else if(!m_allowGlobals && !p_curr_section)
+            {
+                auto msg = CoreString::Format(
+                    "Found a global value but CoreIni is set to not allow them - Line: (%s)",
+                    line
+                );
+
+                if(m_parseMode == INI_PARSE_STRICT)
+                    throw std::logic_error(msg);
+
+                AddDiagnostic(
+                    line_number,
+                    ColumnOf(line, value_name.data()),
+                    INI_DIAGNOSTIC_GLOBAL_VALUE,
+                    std::move(msg)
+                );
+                continue;
+            }
+
+            auto p_value = FindValue(
+                *p_curr_section,
+                value_name,
+                HashName(value_name)
+            );
+            auto exists = (p_value != nullptr);
+            //------------------------------------------------------------------
+            // Disallow any duplicates.
+            if(exists && m_valueDuplicateMode == INI_DUPLICATE_DISALLOW)
+            {
+                auto msg = CoreString::Format(
+                    "Value is duplicated but CoreIni is set to not allow them - Line: (%s)",
+                    line
+                );
+
+                if(m_parseMode == INI_PARSE_STRICT)
+                    throw std::logic_error(msg);
+
+                //--------------------------------------------------------------
+                // Tolerant - Keep the first one.
+                AddDiagnostic(
+                    line_number,
+                    ColumnOf(line, value_name.data()),
+                    INI_DIAGNOSTIC_DUPLICATE_VALUE,
+                    std::move(msg)
+                );
+            }
+            //------------------------------------------------------------------
+            // Ignore any duplicates.
+            else if(exists && m_valueDuplicateMode == INI_DUPLICATE_IGNORE)
+            {
+                // Just ignore...
+                continue;
+            }
+            //------------------------------------------------------------------
+            // Overwrite any duplicates.
+            else if(exists && m_valueDuplicateMode == INI_DUPLICATE_OVERWRITE)
+            {
+                auto &value = *const_cast<Value *>(p_value);
+                OverwriteContent(*p_curr_section, value, std::string(content));
+                value.m_lineNumber = line_number;
+
+                if(!segments.empty())
+                {
+                    SetSegments(*p_curr_section, value, std::move(segments));
+                    continuations.push_back(value.m_pContinuation);
+                }
+            }
+            //------------------------------------------------------------------
+            // Merge any duplicates - Keep all the contents.
+            //   Only the first content is kept in pieces, the others are
+            //   joined right away.
+            else if(exists && m_valueDuplicateMode == INI_DUPLICATE_MERGE)
+            {
+                auto joined = std::string(content);
+                if(!segments.empty())
+                {
+                    joined.clear();
+                    for(const auto &segment : segments)
+                        joined.append(segment.data(), segment.size());
+                }
+
+                AppendContent(
+                    *p_curr_section,
+                    *const_cast<Value *>(p_value),
+                    std::move(joined)
+                );
+            }
+            //------------------------------------------------------------------
+            // Doesn't exits, just add.
+            else
+            {
+                auto &value = InsertValue(
+                    *p_curr_section,
+                    std::string(value_name),
+                    std::string(content   )
+                );
+                value.m_lineNumber = line_number;
+
+                if(!segments.empty())
+                {
+                    SetSegments(*p_curr_section, value, std::move(segments));
+                    continuations.push_back(value.m_pContinuation);
+                }
+            }
+
+            continue;
+        } // if(IsValueLine(line, ...))
+
+        //----------------------------------------------------------------------
+        // Not a comment, a section or a value - The line is dropped in both
+        // parse modes, but now the caller knows about it.
+        DiagnoseLine(line, line_number);
+    } // for(size_t i = 0; i < lines.size(); ++i)
+
+    CompactContinuations(continuations);
+}
+
+void Ini::DiagnoseLine(const std::string &line, size_t lineNumber)
+{
+    auto clean_line = CoreString::Trim(StripComments(line));
+    auto delimiter  = clean_line.find(m_keyValueDelimiter);
+
+    //--------------------------------------------------------------------------
+    // Quotes - The comments chars can be inside them, so look at the
+    // whole line.
+    auto raw_delimiter = line.find(m_keyValueDelimiter);
+    auto raw_content   = (raw_delimiter != std::string::npos)
+        ? TrimView(std::string_view(line).substr(raw_delimiter + 1))
+        : std::string_view();
+
+    //--------------------------------------------------------------------------
+    // Columns point to what is wrong - e.g. the opening quote, or just
+    // after the delimiter of a value without content.
+    if(m_allowQuoted && !raw_content.empty() && raw_content.front() == '"' &&
+       delimiter != std::string::npos && delimiter != 0)
+    {
+        AddDiagnostic(
+            lineNumber,
+            ColumnOf(line, raw_content.data()),
+            INI_DIAGNOSTIC_BAD_QUOTES,
+            CoreString::Format("Quote isn't closed or isn't the end of the content - Line: (%s)", line)
+        );
+    }
+    else if(clean_line.front() == '[')
+    {
+        AddDiagnostic(
+            lineNumber,
+            line.find('[') + 1,
+            INI_DIAGNOSTIC_MALFORMED_SECTION,
+            CoreString::Format("Section isn't closed by ] - Line: (%s)", line)
+        );
+    }
+    else if(delimiter == std::string::npos)
+    {
+        AddDiagnostic(
+            lineNumber,
+            line.find_first_not_of(" \t") + 1,
+            INI_DIAGNOSTIC_MISSING_DELIMITER,
+            CoreString::Format("Value doesn't have a delimiter - Line: (%s)", line)
+        );
+    }
+    else if(CoreString::IsNullOrWhiteSpace(clean_line.substr(0, delimiter)))
+    {
+        AddDiagnostic(
+            lineNumber,
+            raw_delimiter + 1,
+            INI_DIAGNOSTIC_EMPTY_NAME,
+            CoreString::Format("Value doesn't have a name - Line: (%s)", line)
+        );
+    }
+    else
+    {
+        AddDiagnostic(
+            lineNumber,
+            raw_delimiter + 2,
+            INI_DIAGNOSTIC_EMPTY_CONTENT,
+            CoreString::Format("Value doesn't have a content - Line: (%s)", line)
+        );
+    }
+}
+
+void Ini::AddDiagnostic(
+    size_t      lineNumber,
+    size_t      column,
+    uint8_t     kind,
+    std::string message)
+{
+    m_diagnostics.push_back({ lineNumber, column, kind, std::move(message) });
+}
+
+void Ini::ReadContinuation(
+    const std::vector<std::string>  &lines,
+    size_t                          *pIndex,
+    std::string_view                 content,
+    std::vector<std::string_view>   *pOut_Segments) const
+{
+    COREASSERT_ASSERT(pIndex,        "pIndex can't be nullptr"       );
+    COREASSERT_ASSERT(pOut_Segments, "pOut_Segments can't be nullptr");
+
+    //--------------------------------------------------------------------------
+    // First piece - The content of the value line, without the backslash.
+    pOut_Segments->push_back(content.substr(0, content.size() - 1));
+
+    //--------------------------------------------------------------------------
+    // Next lines - Trimmed and taken as is, comments chars included, until
+    // one that doesn't end with a backslash.
+    while(*pIndex + 1 < lines.size())
+    {
+        auto line = TrimView(lines[++(*pIndex)]);
+        if(line.empty() || line.back() != '\\')
+        {
+            pOut_Segments->push_back(line);
+            break;
+        }
+
+        pOut_Segments->push_back(line.substr(0, line.size() - 1));
+    }
+}
+
+void Ini::SetSegments(
+    Section                       &section,
+    Value                         &value,
+    std::vector<std::string_view>  segments)
+{
+    auto p_continuation = std::make_shared<Value::Continuation>();
+    p_continuation->joined.store(false, std::memory_order_relaxed);
+    p_continuation->size = 0;
+    for(const auto &segment : segments)
+        p_continuation->size += segment.size();
+
+    p_continuation->segments = std::move(segments);
+
+    SetContinuation(section, value, std::move(p_continuation));
+}
+
+void Ini::CompactContinuations(
+    const std::vector<std::shared_ptr<Value::Continuation>> &continuations)
+{
+    //--------------------------------------------------------------------------
+    // The lines go away with the parse - Only the pieces of the values
+    // that are still continued are copied, to a single buffer. The ones
+    // that were overwritten are only referenced here.
+    if(continuations.empty())
+        return;
+
+    auto size = size_t(0);
+    for(const auto &p_continuation : continuations)
+    {
+        if(p_continuation.use_count() != 1)
+            size += p_continuation->size;
+    }
+
+    auto p_pieces = std::make_shared<std::string>();
+    p_pieces->reserve(size);
+    for(const auto &p_continuation : continuations)
+    {
+        if(p_continuation.use_count() == 1)
+            continue;
+
+        for(const auto &segment : p_continuation->segments)
+            p_pieces->append(segment.data(), segment.size());
+    }
+
+    //--------------------------------------------------------------------------
+    // The buffer doesn't grow anymore, so the pieces can point to it.
+    auto offset = size_t(0);
+    for(const auto &p_continuation : continuations)
+    {
+        if(p_continuation.use_count() == 1)
+            continue;
+
+        for(auto &segment : p_continuation->segments)
+        {
+            segment = std::string_view(p_pieces->data() + offset, segment.size());
+            offset += segment.size();
+        }
+
+        p_continuation->pPieces = p_pieces;
+    }
+}
+
+void Ini::SetContinuation(
+    Section                              &section,
+    Value                                &value,
+    std::shared_ptr<Value::Continuation>  pContinuation)
+{
+    value.m_content.clear();
+    value.m_pContinuation = std::move(pContinuation);
+
+    //--------------------------------------------------------------------------
+    // Hashed piece by piece - The same hash of the joined content.
+    auto hash   = Hash::kOffsetBasis;
+    auto reader = ValueReader(value);
+    while(!reader.IsEof())
+    {
+        auto chunk = reader.ReadChunk();
+        hash = Hash::HashBytes(chunk.data(), chunk.size(), hash);
+    }
+
+    SetContentsHash(section, value, hash);
+}
+
+bool Ini::IsCommentLine(const std::string &line) const noexcept
+{
+    //--------------------------------------------------------------------------
+    // Empty lines aren't considered comments.
+    if(line.empty())
+        return false;
+
+    //--------------------------------------------------------------------------
+    // We don't care for leading empty chars.
+    auto clean = CoreString::TrimStart(line);
+    if(clean.empty())
+        return false;
+
+    //--------------------------------------------------------------------------
+    // Semicolon ;
+    if(clean.front() == ';' && ACOW_FLAG_HAS(INI_COMMENT_SEMICOLON, m_commentType))
+        return true;
+
+    //--------------------------------------------------------------------------
+    // Hash #
+    if(clean.front() == '#' && ACOW_FLAG_HAS(INI_COMMENT_HASH, m_commentType))
+        return true;
+
+    // COWTODO(n2omatt): What we gonna do with INI_COMMENT_NONE???
+
+    return false;
+}
+
+bool Ini::IsSectionLine(
+    const std::string &line,
+    std::string       *pOut_SectionName) const noexcept
+{
+    COREASSERT_ASSERT(pOut_SectionName, "pOut_SectionName can't be nullptr");
+
+    //COWTODO(n2omatt): Use regex???
+    auto clean_name  = CoreString::Trim(StripComments(line));
+
+    //--------------------------------------------------------------------------
+    // Empty string - Can't be section name.
+    if(clean_name.empty())
+        return false;
+
+    //--------------------------------------------------------------------------
+    // Section name must be inside brackets [, ]
+    if(clean_name.front() == '[' && clean_name.back() == ']')
+    {
+        *pOut_SectionName = std::string(
+            std::begin(clean_name) +1,
+            std::end  (clean_name) -1
+        );
+        return true;
+    }
+
+    //--------------------------------------------------------------------------
+    // Doesn't matches the requirement of be inside brackets [, ]
+    return false;
+}
+
+bool Ini::IsValueLine(
+    const std::string &line,
+    std::string_view  *pOut_Name,
+    std::string_view  *pOut_Content,
+    std::string       *pOut_Unescaped,
+    bool              *pOut_Quoted) const
+{
+    COREASSERT_ASSERT(pOut_Name,      "pOut_Name can't be nullptr"     );
+    COREASSERT_ASSERT(pOut_Content,   "pOut_Content can't be nullptr"  );
+    COREASSERT_ASSERT(pOut_Unescaped, "pOut_Unescaped can't be nullptr");
+    COREASSERT_ASSERT(pOut_Quoted,    "pOut_Quoted can't be nullptr"   );
+
+    //--------------------------------------------------------------------------
+    // A single scan over the line - Name and content are slices of it,
+    // only contents with escapes are copied (to pOut_Unescaped).
+    auto view = std::string_view(line);
+    auto size = view.size();
+    auto i    = size_t(0);
+
+    //--------------------------------------------------------------------------
+    // Name - Up to the first delimiter, the others are part of the
+    // content, i.e. url = http://host/?a=b
+    while(i < size && view[i] != m_keyValueDelimiter)
+    {
+        if(IsCommentChar(view[i]))
+            return false;
+        ++i;
+    }
+
+    if(i == size)
+        return false;
+
+    auto name = TrimView(view.substr(0, i));
+    if(name.empty())
+        return false;
+
+    //--------------------------------------------------------------------------
+    // Content.
+    ++i;
+    while(i < size && IsBlank(view[i]))
+        ++i;
+
+    if(i == size || IsCommentChar(view[i]))
+        return false;
+
     //--------------------------------------------------------------------------
-    // Copy...
-    (*pOut_KeyVal)[0] = key;
-    (*pOut_KeyVal)[1] = value;
+    // Quoted - Comment chars and delimiters are part of the content, and
+    // so can be an empty content ("").
+    if(m_allowQuoted && view[i] == '"')
+    {
+        auto begin   = ++i;
+        auto escaped = false;
+
+        while(i < size && view[i] != '"')
+        {
+            auto c = (view[i] == '\\' && i + 1 < size) ? Unescape(view[i + 1]) : 0;
+            if(c != 0)
+            {
+                if(!escaped)
+                    pOut_Unescaped->assign(view.data() + begin, i - begin);
+
+                pOut_Unescaped->push_back(c);
+                escaped = true;
+                i      += 2;
+                continue;
+            }
+
+            if(escaped)
+                pOut_Unescaped->push_back(view[i]);
+            ++i;
+        }
+
+        //----------------------------------------------------------------------
+        // Quote not closed.
+        if(i == size)
+            return false;
+
+        *pOut_Content = (escaped)
+            ? std::string_view(*pOut_Unescaped)
+            : view.substr(begin, i - begin);
+
+        //----------------------------------------------------------------------
+        // Only blanks and comments after the closing quote.
+        ++i;
+        while(i < size && IsBlank(view[i]))
+            ++i;
+
+        if(i != size && !IsCommentChar(view[i]))
+            return false;
+
+        *pOut_Name   = name;
+        *pOut_Quoted = true;
+
+        return true;
+    }
+
+    //--------------------------------------------------------------------------
+    // Plain - Up to the first comment char.
+    auto begin = i;
+    while(i < size && !IsCommentChar(view[i]))
+        ++i;
+
+    *pOut_Name    = name;
+    *pOut_Content = TrimView(view.substr(begin, i - begin));
+    *pOut_Quoted  = false;
 
     return true;
 }
 
+bool Ini::IsCommentChar(char c) const noexcept
+{
+    return (c == '#' && (m_commentType & INI_COMMENT_HASH     ))
+        || (c == ';' && (m_commentType & INI_COMMENT_SEMICOLON));
+}
+
 std::string Ini::StripComments(const std::string &line) const noexcept
 {
     if(m_commentType == INI_COMMENT_NONE)
@@ -614,3 +1492,583 @@ std::string Ini::StripComments(const std::string &line) const noexcept
     auto first_index = CoreString::IndexOfAny(line, comment_chars);
     return line.substr(0, first_index);
 }
+
+
+uint64_t Ini::HashName(std::string_view name) const noexcept
+{
+    return Hash::HashName(name.data(), name.size(), m_caseInsensitive);
+}
+
+bool Ini::NamesEqual(
+    std::string_view lhs,
+    std::string_view rhs) const noexcept
+{
+    if(!m_caseInsensitive)
+        return lhs == rhs;
+
+    if(lhs.size() != rhs.size())
+        return false;
+
+    return std::equal(
+        std::begin(lhs),
+        std::end  (lhs),
+        std::begin(rhs),
+        [](char a, char b) {
+            return Hash::FoldCase(a) == Hash::FoldCase(b);
+        }
+    );
+}
+
+const Section* Ini::FindSection(
+    std::string_view name,
+    uint64_t         hash) const noexcept
+{
+    //--------------------------------------------------------------------------
+    // The pinned sections first - They're the most accessed ones.
+    for(const auto &pinned : m_pinnedSections)
+    {
+        const auto &section = m_sections[pinned.sectionIndex];
+        if(pinned.hash == hash && NamesEqual(section.m_name, name))
+            return &section;
+    }
+
+    //--------------------------------------------------------------------------
+    // Different names can share the same hash, so we need to check them.
+    auto range = m_sectionsIndex.equal_range(hash);
+    for(auto it = range.first; it != range.second; ++it)
+    {
+        const auto &section = m_sections[it->second];
+        if(NamesEqual(section.m_name, name))
+            return &section;
+    }
+
+    return nullptr;
+}
+
+const Value* Ini::FindValue(
+    const Section    &section,
+    std::string_view  name,
+    uint64_t          hash) const noexcept
+{
+    //--------------------------------------------------------------------------
+    // Finalized - The values indexes are empty, use the table.
+    if(IsFinalized())
+    {
+        auto p_section = static_cast<const Section *>(nullptr);
+        auto p_value   = FindFinalValue(section.m_name, section.m_hash, name, hash, &p_section);
+
+        return (p_section == &section) ? p_value : nullptr;
+    }
+
+    //--------------------------------------------------------------------------
+    // Different names can share the same hash, so we need to check them.
+    auto range = section.m_valuesIndex.equal_range(hash);
+    for(auto it = range.first; it != range.second; ++it)
+    {
+        const auto &value = section.m_values[it->second];
+        if(NamesEqual(value.m_name, name))
+            return &value;
+    }
+
+    return nullptr;
+}
+
+Section& Ini::InsertSection(std::string name)
+{
+    DropFinalIndex();
+
+    m_sections.emplace_back();
+
+    auto &section  = m_sections.back();
+    section.m_name = std::move(name);
+    section.m_hash = HashName(section.m_name);
+    m_sectionsIndex.emplace(section.m_hash, m_sections.size() - 1);
+
+    //--------------------------------------------------------------------------
+    // The name is part of the hash, so empty sections count as well.
+    section.m_contentHash  = Hash::Mix(section.m_hash);
+    m_contentHash         += Hash::Mix(section.m_contentHash);
+
+    return section;
+}
+
+Value& Ini::InsertValue(
+    Section     &section,
+    std::string  name,
+    std::string  content)
+{
+    DropFinalIndex();
+
+    section.m_values.emplace_back();
+
+    auto &value     = section.m_values.back();
+    value.m_name    = std::move(name);
+    value.m_content = std::move(content);
+    value.m_hash    = HashName(value.m_name);
+    section.m_valuesIndex.emplace(value.m_hash, section.m_values.size() - 1);
+
+    value.m_contentsHash   = Hash::HashBytes(value.m_content.data(), value.m_content.size());
+    SetSectionContentHash(section, section.m_contentHash + value.GetContentHash());
+
+    return value;
+}
+
+const Section& Ini::LookupSection(const std::string &name) const
+{
+    auto p_section = FindSection(name, HashName(name));
+
+    INI_THROW_IF(
+        !p_section,
+        std::invalid_argument,
+        "Section doesn't exists - path: (%s)",
+        name.c_str()
+    );
+
+    return *p_section;
+}
+
+const Value& Ini::LookupValue(
+    const std::string  &sectionName,
+    const std::string  &valueName,
+    const Section     **ppSection) const
+{
+    return LookupValue(
+        sectionName, HashName(sectionName),
+        valueName,   HashName(valueName  ),
+        ppSection
+    );
+}
+
+const Value& Ini::LookupValue(
+    std::string_view    sectionName,
+    uint64_t            sectionHash,
+    std::string_view    valueName,
+    uint64_t            valueHash,
+    const Section     **ppSection) const
+{
+    //--------------------------------------------------------------------------
+    // Finalized - A single probe on the table.
+    if(IsFinalized())
+    {
+        auto p_value = FindFinalValue(
+            sectionName, sectionHash,
+            valueName,   valueHash,
+            ppSection
+        );
+
+        if(p_value)
+            return *p_value;
+    }
+
+    //--------------------------------------------------------------------------
+    // Then the pinned values - They're the most accessed ones.
+    if(!m_pinnedValues.empty())
+    {
+        auto hash = Hash::Combine(sectionHash, valueHash);
+        for(const auto &pinned : m_pinnedValues)
+        {
+            if(pinned.hash != hash)
+                continue;
+
+            const auto &section = m_sections[pinned.sectionIndex];
+            const auto &value   = section.m_values[pinned.valueIndex];
+            if(NamesEqual(value.m_name, valueName) && NamesEqual(section.m_name, sectionName))
+            {
+                if(ppSection)
+                    *ppSection = &section;
+
+                return value;
+            }
+        }
+    }
+
+    auto p_section = FindSection(sectionName, sectionHash);
+    INI_THROW_IF(
+        !p_section,
+        std::invalid_argument,
+        "Section doesn't exists - path: (%s)",
+        std::string(sectionName).c_str()
+    );
+
+    auto p_value = FindValue(*p_section, valueName, valueHash);
+    INI_THROW_IF(
+        !p_value,
+        std::invalid_argument,
+        "Section (%s) - Value (%s) doesn't exists.",
+        std::string(sectionName).c_str(),
+        std::string(valueName  ).c_str()
+    );
+
+    if(ppSection)
+        *ppSection = p_section;
+
+    return *p_value;
+}
+
+const Value* Ini::FindFinalValue(
+    std::string_view    sectionName,
+    uint64_t            sectionHash,
+    std::string_view    valueName,
+    uint64_t            valueHash,
+    const Section     **ppSection) const noexcept
+{
+    auto hash   = Hash::Combine(sectionHash, valueHash);
+    auto bucket = Hash::Mix(hash) % m_finalDisplacements.size();
+    auto slot   = FinalSlot(hash, m_finalDisplacements[bucket], m_finalEntries.size());
+
+    //--------------------------------------------------------------------------
+    // Pairs that aren't on the table land on any slot - So check it.
+    const auto &entry = m_finalEntries[slot];
+    if(entry.hash != hash)
+        return nullptr;
+
+    const auto &section = m_sections[entry.sectionIndex];
+    const auto &value   = section.m_values[entry.valueIndex];
+    if(!NamesEqual(value.m_name, valueName) || !NamesEqual(section.m_name, sectionName))
+        return nullptr;
+
+    if(ppSection)
+        *ppSection = &section;
+
+    return &value;
+}
+
+size_t Ini::FinalSlot(
+    uint64_t hash,
+    uint32_t displacement,
+    size_t   size) noexcept
+{
+    return Hash::Mix(hash + (uint64_t(displacement) + 1) * 0x9E3779B97F4A7C15ull) % size;
+}
+
+void Ini::DropFinalIndex()
+{
+    if(!IsFinalized())
+        return;
+
+    decltype(m_finalDisplacements)().swap(m_finalDisplacements);
+    decltype(m_finalEntries      )().swap(m_finalEntries      );
+
+    //--------------------------------------------------------------------------
+    // Finalize freed the values indexes.
+    for(auto &section : m_sections)
+        RebuildValuesIndex(section);
+}
+
+void Ini::CountAccess(const Section &section, const Value *pValue) const
+{
+    ++m_sectionAccessCounts[section.m_hash];
+    if(pValue)
+        ++m_valueAccessCounts[Hash::Combine(section.m_hash, pValue->m_hash)];
+}
+
+void Ini::EraseAccessCounts(const Section &section) noexcept
+{
+    if(m_valueAccessCounts.empty())
+        return;
+
+    for(const auto &value : section.m_values)
+        m_valueAccessCounts.erase(Hash::Combine(section.m_hash, value.m_hash));
+}
+
+std::vector<Ini::AccessCount> Ini::SortAccessCounts(
+    std::vector<AccessCount> counts,
+    size_t                   count)
+{
+    auto middle = counts.begin() + std::min(count, counts.size());
+    std::partial_sort(
+        std::begin(counts),
+        middle,
+        std::end  (counts),
+        [](const AccessCount &lhs, const AccessCount &rhs) {
+            return lhs.count > rhs.count;
+        }
+    );
+
+    counts.erase(middle, std::end(counts));
+    return counts;
+}
+
+void Ini::OverwriteContent(
+    Section     &section,
+    Value       &value,
+    std::string  content)
+{
+    InvalidateInterpolation(section, value);
+
+    value.m_content = std::move(content);
+    value.m_moreContents.clear();
+    SetContentsHash(
+        section,
+        value,
+        Hash::HashBytes(value.m_content.data(), value.m_content.size())
+    );
+
+    value.m_pContinuation.reset();
+}
+
+void Ini::AppendContent(
+    Section     &section,
+    Value       &value,
+    std::string  content)
+{
+    //--------------------------------------------------------------------------
+    // Mixed before the next content, so ("ab", "c") and ("a", "bc") don't
+    // end up with the same hash.
+    SetContentsHash(
+        section,
+        value,
+        Hash::HashBytes(content.data(), content.size(), Hash::Mix(value.m_contentsHash))
+    );
+
+    //--------------------------------------------------------------------------
+    // The first content doesn't change, so nothing to invalidate.
+    value.m_moreContents.push_back(std::move(content));
+}
+
+void Ini::SetContentsHash(
+    Section &section,
+    Value   &value,
+    uint64_t contentsHash) noexcept
+{
+    //--------------------------------------------------------------------------
+    // The section's sum is updated by the difference - Wrapping is fine.
+    auto old_hash = value.GetContentHash();
+    value.m_contentsHash = contentsHash;
+    auto new_hash = value.GetContentHash();
+
+    SetSectionContentHash(section, section.m_contentHash + new_hash - old_hash);
+}
+
+void Ini::SetSectionContentHash(
+    Section &section,
+    uint64_t contentHash) noexcept
+{
+    //--------------------------------------------------------------------------
+    // The section's contribution is replaced, not its difference added -
+    // It's mixed, so the same values on another section don't cancel out.
+    m_contentHash         -= Hash::Mix(section.m_contentHash);
+    section.m_contentHash  = contentHash;
+    m_contentHash         += Hash::Mix(section.m_contentHash);
+}
+
+void Ini::RebuildSectionsIndex()
+{
+    DropFinalIndex();
+
+    m_sectionsIndex.clear();
+    for(size_t i = 0; i < m_sections.size(); ++i)
+        m_sectionsIndex.emplace(m_sections[i].m_hash, i);
+}
+
+void Ini::RebuildValuesIndex(Section &section)
+{
+    DropFinalIndex();
+
+    section.m_valuesIndex.clear();
+    for(size_t i = 0; i < section.m_values.size(); ++i)
+        section.m_valuesIndex.emplace(section.m_values[i].m_hash, i);
+}
+
+
+const std::string& Ini::Interpolate(
+    const Section &section,
+    const Value   &value) const
+{
+    //--------------------------------------------------------------------------
+    // A memo of another value - Copies of the Ini, or values that were
+    // moved, expand it again.
+    auto &memo = m_interpolations[Hash::Combine(section.m_hash, value.m_hash)];
+    if(memo.pValue != &value)
+    {
+        memo.pValue = &value;
+        memo.state  = INTERPOLATION_DIRTY;
+        memo.content.clear();
+    }
+
+    //--------------------------------------------------------------------------
+    // Already expanded.
+    if(memo.state == INTERPOLATION_PLAIN)
+        return value.GetContent();
+    if(memo.state == INTERPOLATION_RESOLVED)
+        return memo.content;
+
+    //--------------------------------------------------------------------------
+    // We're expanding this value and got here again...
+    INI_THROW_IF(
+        memo.state == INTERPOLATION_RESOLVING,
+        std::logic_error,
+        "Interpolation cycle found - Section: (%s) - Value: (%s)",
+        section.m_name.c_str(),
+        value  .m_name.c_str()
+    );
+
+    //--------------------------------------------------------------------------
+    // Nothing to expand - Don't need to keep a copy.
+    const auto &content = value.GetContent();
+    if(content.find('$') == std::string::npos)
+    {
+        memo.state = INTERPOLATION_PLAIN;
+        return content;
+    }
+
+    memo.state = INTERPOLATION_RESOLVING;
+    try
+    {
+        auto result = std::string();
+        result.reserve(content.size());
+
+        auto i = size_t(0);
+        while(i < content.size())
+        {
+            auto dollar = content.find('$', i);
+            if(dollar == std::string::npos)
+            {
+                result.append(content, i, std::string::npos);
+                break;
+            }
+
+            result.append(content, i, dollar - i);
+            auto next = (dollar + 1 < content.size()) ? content[dollar + 1] : '\0';
+
+            //------------------------------------------------------------------
+            // $$ or a $ that doesn't starts a reference.
+            if(next != '{')
+            {
+                result += '$';
+                i = (next == '$') ? dollar + 2 : dollar + 1;
+                continue;
+            }
+
+            auto close = content.find('}', dollar + 2);
+            INI_THROW_IF(
+                close == std::string::npos,
+                std::logic_error,
+                "Unterminated reference - Section: (%s) - Value: (%s)",
+                section.m_name.c_str(),
+                value  .m_name.c_str()
+            );
+
+            auto reference = content.substr(dollar + 2, close - dollar - 2);
+            auto colon     = reference.find(':');
+
+            auto ref_section_name = (colon == std::string::npos)
+                ? section.m_name
+                : reference.substr(0, colon);
+            auto ref_value_name = (colon == std::string::npos)
+                ? reference
+                : reference.substr(colon + 1);
+
+            //------------------------------------------------------------------
+            // Environment variable.
+            if(colon != std::string::npos && ref_section_name == "env")
+            {
+                auto p_env = std::getenv(ref_value_name.c_str());
+                INI_THROW_IF(
+                    !p_env,
+                    std::invalid_argument,
+                    "Environment variable: (%s) referenced by Section: (%s) - Value: (%s) doesn't exists.",
+                    ref_value_name.c_str(),
+                    section.m_name.c_str(),
+                    value  .m_name.c_str()
+                );
+
+                result += p_env;
+            }
+            //------------------------------------------------------------------
+            // Another value.
+            else
+            {
+                auto p_ref_section = FindSection(
+                    ref_section_name,
+                    HashName(ref_section_name)
+                );
+                auto p_ref_value = (p_ref_section)
+                    ? FindValue(*p_ref_section, ref_value_name, HashName(ref_value_name))
+                    : nullptr;
+
+                INI_THROW_IF(
+                    !p_ref_value,
+                    std::invalid_argument,
+                    "Section: (%s) - Value: (%s) referenced by Section: (%s) - Value: (%s) doesn't exists.",
+                    ref_section_name.c_str(),
+                    ref_value_name  .c_str(),
+                    section.m_name  .c_str(),
+                    value  .m_name  .c_str()
+                );
+
+                //--------------------------------------------------------------
+                // Keep track that this value must be expanded again if the
+                // referenced value changes.
+                auto &dependents = m_interpolationDependents[
+                    Hash::Combine(p_ref_section->m_hash, p_ref_value->m_hash)
+                ];
+                auto dependent = std::make_pair(section.m_name, value.m_name);
+                if(std::find(std::begin(dependents), std::end(dependents), dependent) == std::end(dependents))
+                    dependents.push_back(std::move(dependent));
+
+                result += Interpolate(*p_ref_section, *p_ref_value);
+            }
+
+            i = close + 1;
+        }
+
+        memo.content = std::move(result);
+        memo.state   = INTERPOLATION_RESOLVED;
+    }
+    catch(...)
+    {
+        memo.state = INTERPOLATION_DIRTY;
+        throw;
+    }
+
+    return memo.content;
+}
+
+void Ini::InvalidateInterpolation(
+    const Section &section,
+    const Value   &value) const noexcept
+{
+    //--------------------------------------------------------------------------
+    // Nothing was expanded, so nothing depends on this value.
+    if(m_interpolations.empty() && m_interpolationDependents.empty())
+        return;
+
+    auto hash = Hash::Combine(section.m_hash, value.m_hash);
+    m_interpolations.erase(hash);
+
+    auto it = m_interpolationDependents.find(hash);
+    if(it == std::end(m_interpolationDependents))
+        return;
+
+    //--------------------------------------------------------------------------
+    // Dependents register themselves again when they're expanded.
+    auto dependents = std::move(it->second);
+    m_interpolationDependents.erase(it);
+
+    for(const auto &dependent : dependents)
+    {
+        auto p_section = FindSection(
+            dependent.first,
+            HashName(dependent.first)
+        );
+        if(!p_section)
+            continue;
+
+        auto p_value = FindValue(
+            *p_section,
+            dependent.second,
+            HashName(dependent.second)
+        );
+        if(!p_value)
+            continue;
+
+        InvalidateInterpolation(*p_section, *p_value);
+    }
+}
+
+void Ini::InvalidateInterpolation(const Section &section) const noexcept
+{
+    for(const auto &value : section.m_values)
+        InvalidateInterpolation(section, value);
+}
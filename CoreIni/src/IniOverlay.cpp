@@ -0,0 +1,287 @@
+//~---------------------------------------------------------------------------//
+//                     _______  _______  _______  _     _                     //
+//                    |   _   ||       ||       || | _ | |                    //
+//                    |  |_|  ||       ||   _   || || || |                    //
+//                    |       ||       ||  | |  ||       |                    //
+//                    |       ||      _||  |_|  ||       |                    //
+//                    |   _   ||     |_ |       ||   _   |                    //
+//                    |__| |__||_______||_______||__| |__|                    //
+//                             www.amazingcow.com                             //
+//  File      : IniOverlay.cpp                                                //
+//  Project   : CoreIni                                                       //
+//  Date      : Oct 18, 2026                                                  //
+//  License   : GPLv3                                                         //
+//  Author    : n2omatt <n2omatt@amazingcow.com>                              //
+//  Copyright : AmazingCow - 2017, 2018                                       //
+//                                                                            //
+//  Description :                                                             //
+//    Layered view over a stack of Ini.                                       //
+//---------------------------------------------------------------------------~//
+
+
+
+// Header
+#include "../include/IniOverlay.h"
+// std
+#include <algorithm>
+#include <unordered_set>
+#include <utility>
+// CoreIni
+#include "CoreIni_Private.h"
+
+// Usings
+USING_NS_COREINI;
+
+
+//----------------------------------------------------------------------------//
+// Helpers                                                                    //
+//----------------------------------------------------------------------------//
+namespace {
+
+inline std::string FoldName(std::string name)
+{
+    for(auto &c : name)
+        c = Hash::FoldCase(c);
+
+    return name;
+}
+
+} // anonymous namespace
+
+
+//----------------------------------------------------------------------------//
+// CTOR / DTOR                                                                //
+//----------------------------------------------------------------------------//
+IniOverlay::IniOverlay(std::vector<IniPtr_t> layers /* = {} */)
+    : m_layers   (std::move(layers))
+    , m_foldsCase(false)
+{
+    for(const auto &p_ini : m_layers)
+    {
+        INI_THROW_IF(!p_ini, std::invalid_argument, "%s", "Layer can't be null");
+        m_foldsCase = m_foldsCase || p_ini->m_caseInsensitive;
+    }
+}
+
+
+//----------------------------------------------------------------------------//
+// Layers                                                                     //
+//----------------------------------------------------------------------------//
+size_t IniOverlay::PushLayer(IniPtr_t pIni)
+{
+    INI_THROW_IF(!pIni, std::invalid_argument, "%s", "Layer can't be null");
+
+    //--------------------------------------------------------------------------
+    // The new layer shadows the others only on the sections that it has.
+    InvalidateLayer(*pIni);
+    m_layers.push_back(std::move(pIni));
+
+    return m_layers.size() - 1;
+}
+
+void IniOverlay::SetLayer(size_t index, IniPtr_t pIni)
+{
+    INI_THROW_IF(
+        index >= m_layers.size(),
+        std::out_of_range,
+        "Invalid layer - index: (%zu) - layers: (%zu)",
+        index,
+        m_layers.size()
+    );
+    INI_THROW_IF(!pIni, std::invalid_argument, "%s", "Layer can't be null");
+
+    //--------------------------------------------------------------------------
+    // Values of both layers may be cached - Sections that aren't in any of
+    // them are resolved the same way as before.
+    InvalidateLayer(*m_layers[index]);
+    InvalidateLayer(*pIni);
+    m_layers[index] = std::move(pIni);
+}
+
+const IniOverlay::IniPtr_t& IniOverlay::GetLayer(size_t index) const
+{
+    INI_THROW_IF(
+        index >= m_layers.size(),
+        std::out_of_range,
+        "Invalid layer - index: (%zu) - layers: (%zu)",
+        index,
+        m_layers.size()
+    );
+
+    return m_layers[index];
+}
+
+void IniOverlay::ClearCache() noexcept
+{
+    m_cache         .clear();
+    m_cacheSpellings.clear();
+}
+
+
+//----------------------------------------------------------------------------//
+// Section                                                                    //
+//----------------------------------------------------------------------------//
+const Section& IniOverlay::GetSection(const std::string &path) const
+{
+    for(auto it = m_layers.rbegin(); it != m_layers.rend(); ++it)
+    {
+        const auto &ini = **it;
+
+        auto p_section = ini.FindSection(path, ini.HashName(path));
+        if(p_section)
+            return *p_section;
+    }
+
+    throw std::invalid_argument(CoreString::Format(
+        "Section doesn't exists - path: (%s)",
+        path.c_str()
+    ));
+}
+
+std::vector<std::string> IniOverlay::GetSectionNames() const
+{
+    auto names = std::vector<std::string>();
+    auto seen  = std::unordered_set<std::string>();
+
+    for(auto it = m_layers.rbegin(); it != m_layers.rend(); ++it)
+    {
+        for(const auto &section : (*it)->GetSections())
+        {
+            if(seen.insert(section.GetName()).second)
+                names.push_back(section.GetName());
+        }
+    }
+
+    return names;
+}
+
+bool IniOverlay::SectionExists(const std::string &path) const noexcept
+{
+    for(const auto &p_ini : m_layers)
+    {
+        if(p_ini->FindSection(path, p_ini->HashName(path)))
+            return true;
+    }
+
+    return false;
+}
+
+
+//----------------------------------------------------------------------------//
+// Value                                                                      //
+//----------------------------------------------------------------------------//
+const Value& IniOverlay::GetValue(
+    const std::string &sectionName,
+    const std::string &valueName) const
+{
+    const auto &entry = Resolve(sectionName, valueName);
+
+    INI_THROW_IF(
+        !entry.pValue,
+        std::invalid_argument,
+        "Value doesn't exists - Section: (%s) - Value: (%s)",
+        sectionName.c_str(),
+        valueName  .c_str()
+    );
+
+    return *entry.pValue;
+}
+
+bool IniOverlay::ValueExists(
+    const std::string &sectionName,
+    const std::string &valueName) const
+{
+    return Resolve(sectionName, valueName).pValue != nullptr;
+}
+
+size_t IniOverlay::GetValueLayer(
+    const std::string &sectionName,
+    const std::string &valueName) const
+{
+    return Resolve(sectionName, valueName).layer;
+}
+
+
+//----------------------------------------------------------------------------//
+// Private Methods                                                            //
+//----------------------------------------------------------------------------//
+const IniOverlay::CacheEntry& IniOverlay::Resolve(
+    const std::string &sectionName,
+    const std::string &valueName) const
+{
+    auto  result = m_cache.try_emplace(sectionName);
+    auto &bucket = result.first->second;
+    if(result.second && m_foldsCase)
+        m_cacheSpellings[FoldName(sectionName)].push_back(sectionName);
+
+    auto it = bucket.find(valueName);
+    if(it != std::end(bucket))
+        return it->second;
+
+    //--------------------------------------------------------------------------
+    // Not cached yet - Probe from the highest priority layer.
+    auto entry = CacheEntry{ nullptr, kInvalidLayer };
+    for(size_t i = m_layers.size(); i > 0; --i)
+    {
+        const auto &ini = *m_layers[i - 1];
+
+        auto p_section = ini.FindSection(sectionName, ini.HashName(sectionName));
+        if(!p_section)
+            continue;
+
+        auto p_value = ini.FindValue(*p_section, valueName, ini.HashName(valueName));
+        if(!p_value)
+            continue;
+
+        entry = CacheEntry{ p_value, i - 1 };
+        break;
+    }
+
+    return bucket.emplace(valueName, entry).first->second;
+}
+
+void IniOverlay::InvalidateLayer(const Ini &ini)
+{
+    //--------------------------------------------------------------------------
+    // First case insensitive layer - The spellings of what is cached
+    // weren't kept until now.
+    if(ini.m_caseInsensitive && !m_foldsCase)
+    {
+        m_foldsCase = true;
+        ClearCache();
+        return;
+    }
+
+    for(const auto &section : ini.m_sections)
+    {
+        m_cache.erase(section.GetName());
+        if(!m_foldsCase)
+            continue;
+
+        auto it = m_cacheSpellings.find(FoldName(section.GetName()));
+        if(it == std::end(m_cacheSpellings))
+            continue;
+
+        //----------------------------------------------------------------------
+        // The cache is keyed by the names as they're queried - A case
+        // insensitive layer matches all the spellings of its sections.
+        auto &spellings = it->second;
+        if(ini.m_caseInsensitive)
+        {
+            for(const auto &name : spellings)
+                m_cache.erase(name);
+
+            spellings.clear();
+        }
+        else
+        {
+            spellings.erase(
+                std::remove(std::begin(spellings), std::end(spellings), section.GetName()),
+                std::end(spellings)
+            );
+        }
+
+        if(spellings.empty())
+            m_cacheSpellings.erase(it);
+    }
+}
@@ -0,0 +1,383 @@
+//~---------------------------------------------------------------------------//
+//                     _______  _______  _______  _     _                     //
+//                    |   _   ||       ||       || | _ | |                    //
+//                    |  |_|  ||       ||   _   || || || |                    //
+//                    |       ||       ||  | |  ||       |                    //
+//                    |       ||      _||  |_|  ||       |                    //
+//                    |   _   ||     |_ |       ||   _   |                    //
+//                    |__| |__||_______||_______||__| |__|                    //
+//                             www.amazingcow.com                             //
+//  File      : IniWriter.cpp                                                 //
+//  Project   : CoreIni                                                       //
+//  Date      : Oct 18, 2026                                                  //
+//  License   : GPLv3                                                         //
+//  Author    : n2omatt <n2omatt@amazingcow.com>                              //
+//  Copyright : AmazingCow - 2017, 2018                                       //
+//                                                                            //
+//  Description :                                                             //
+//    Streaming writer of INI files.                                          //
+//---------------------------------------------------------------------------~//
+
+
+// Header
+#include "../include/IniWriter.h"
+// std
+#include <algorithm>
+#include <cctype>
+#include <cerrno>
+#include <cstdio>
+#include <cstring>
+#include <exception>
+#include <stdexcept>
+// POSIX
+#include <fcntl.h>
+#include <sys/stat.h>
+#include <unistd.h>
+// CoreIni
+#include "../include/ValueReader.h"
+#include "CoreIni_Private.h"
+
+// Usings
+USING_NS_COREINI;
+
+
+//----------------------------------------------------------------------------//
+// Constants                                                                  //
+//----------------------------------------------------------------------------//
+namespace {
+
+// Chars that can't be on a section name - The comment chars would cut
+// the name when it's read back.
+constexpr auto kInvalidSectionChars = "];#\r\n";
+// Chars that can't be on a value name - Besides the delimiter.
+constexpr auto kInvalidNameChars = ";#\"\r\n";
+
+} // anonymous namespace
+
+
+//----------------------------------------------------------------------------//
+// CTOR / DTOR                                                                //
+//----------------------------------------------------------------------------//
+IniWriter::IniWriter(
+    const std::string &filename,
+    char               keyValueDelimiter, /* = '='                */
+    bool               checkDuplicates,   /* = false              */
+    size_t             bufferSize)        /* = kDefaultBufferSize */
+    : IniWriter(-1, keyValueDelimiter, checkDuplicates, bufferSize)
+{
+    m_filename    = filename;
+    m_tmpFilename = filename + ".tmp";
+
+    m_fd = open(m_tmpFilename.c_str(), O_WRONLY | O_CREAT | O_TRUNC | O_CLOEXEC, 0644);
+    INI_THROW_IF(
+        m_fd == -1,
+        std::runtime_error,
+        "Can't open file: (%s) - %s",
+        m_tmpFilename.c_str(),
+        std::strerror(errno)
+    );
+
+    m_ownsFd = true;
+
+    //--------------------------------------------------------------------------
+    // The renamed file replaces filename, so it keeps its permissions.
+    struct stat file_stat;
+    if(stat(filename.c_str(), &file_stat) == 0)
+        fchmod(m_fd, file_stat.st_mode & 07777);
+}
+
+IniWriter::IniWriter(
+    int    fd,
+    char   keyValueDelimiter, /* = '='                */
+    bool   checkDuplicates,   /* = false              */
+    size_t bufferSize)        /* = kDefaultBufferSize */
+    // Members
+    : m_fd                (fd)
+    , m_ownsFd            (false)
+    , m_uncaughtExceptions(std::uncaught_exceptions())
+    , m_pBuffer           (new char[(bufferSize) ? bufferSize : 1])
+    , m_bufferSize        ((bufferSize) ? bufferSize : 1)
+    , m_bufferUsed        (0)
+    , m_keyValueDelimiter (keyValueDelimiter)
+    , m_hasSections       (false)
+    , m_checkDuplicates   (checkDuplicates)
+{
+    // Empty...
+}
+
+IniWriter::~IniWriter()
+{
+    //--------------------------------------------------------------------------
+    // Something failed while writing, don't replace filename with it.
+    if(std::uncaught_exceptions() > m_uncaughtExceptions)
+    {
+        Discard();
+        return;
+    }
+
+    try {
+        Close();
+    } catch(...) {
+        // Destructors can't throw...
+    }
+}
+
+
+//----------------------------------------------------------------------------//
+// Write                                                                      //
+//----------------------------------------------------------------------------//
+void IniWriter::WriteSection(const std::string &name)
+{
+    INI_THROW_IF(
+        name.empty() || name.find_first_of(kInvalidSectionChars) != std::string::npos,
+        std::invalid_argument,
+        "Invalid section name: (%s)",
+        name.c_str()
+    );
+
+    if(m_checkDuplicates)
+    {
+        INI_THROW_IF(
+            !m_sectionNames.insert(name).second,
+            std::invalid_argument,
+            "Section: (%s) already written.",
+            name.c_str()
+        );
+
+        m_valueNames.clear();
+    }
+
+    //--------------------------------------------------------------------------
+    // Blank line between the sections.
+    if(m_hasSections || m_bufferUsed != 0)
+        Put('\n');
+
+    Put('[');
+    Put(name);
+    Put("]\n", 2);
+
+    m_hasSections = true;
+}
+
+void IniWriter::WriteValue(const std::string &name, const std::string &content)
+{
+    auto reader = ValueReader(content);
+    WriteValue(name, reader);
+}
+
+void IniWriter::WriteValue(const std::string &name, ValueReader &reader)
+{
+    INI_THROW_IF(
+        name.empty()                                             ||
+        name.find(m_keyValueDelimiter)  != std::string::npos     ||
+        name.find_first_of(kInvalidNameChars) != std::string::npos,
+        std::invalid_argument,
+        "Invalid value name: (%s)",
+        name.c_str()
+    );
+
+    if(m_checkDuplicates)
+    {
+        INI_THROW_IF(
+            !m_valueNames.insert(name).second,
+            std::invalid_argument,
+            "Value: (%s) already written on the current section.",
+            name.c_str()
+        );
+    }
+
+    //--------------------------------------------------------------------------
+    // Values of sections are indented, global ones aren't.
+    if(m_hasSections)
+        Put("    ", 4);
+
+    Put(name);
+    Put(' ');
+    Put(m_keyValueDelimiter);
+    Put(' ');
+
+    if(!NeedsQuotes(reader))
+    {
+        while(!reader.IsEof())
+        {
+            auto chunk = reader.ReadChunk();
+            Put(chunk.data(), chunk.size());
+        }
+    }
+    else
+    {
+        Put('"');
+        while(!reader.IsEof())
+        {
+            for(auto c : reader.ReadChunk())
+            {
+                switch(c)
+                {
+                    case '"' : Put("\\\"", 2); break;
+                    case '\\': Put("\\\\", 2); break;
+                    case '\n': Put("\\n",  2); break;
+                    case '\r': Put("\\r",  2); break;
+                    case '\t': Put("\\t",  2); break;
+                    default  : Put(c);         break;
+                }
+            }
+        }
+        Put('"');
+    }
+
+    Put('\n');
+}
+
+void IniWriter::Flush()
+{
+    auto p_data = m_pBuffer.get();
+    auto size   = m_bufferUsed;
+
+    while(size != 0)
+    {
+        auto written = write(m_fd, p_data, size);
+        if(written == -1 && errno == EINTR)
+            continue;
+
+        INI_THROW_IF(
+            written == -1,
+            std::runtime_error,
+            "Can't write to fd: (%d) - %s",
+            m_fd,
+            std::strerror(errno)
+        );
+
+        p_data += written;
+        size   -= size_t(written);
+    }
+
+    m_bufferUsed = 0;
+}
+
+void IniWriter::Close()
+{
+    if(m_fd == -1)
+        return;
+
+    //--------------------------------------------------------------------------
+    // Closes even if the flush fails.
+    auto fd = m_fd;
+    try {
+        Flush();
+    } catch(...) {
+        Discard();
+        throw;
+    }
+
+    m_fd = -1;
+    if(!m_ownsFd)
+        return;
+
+    auto close_failed = (close(fd) == -1);
+    auto close_errno  = errno;
+    if(close_failed)
+        unlink(m_tmpFilename.c_str());
+
+    INI_THROW_IF(
+        close_failed,
+        std::runtime_error,
+        "Can't close fd: (%d) - %s",
+        fd,
+        std::strerror(close_errno)
+    );
+
+    //--------------------------------------------------------------------------
+    // Only a complete file replaces filename.
+    auto rename_failed = (std::rename(m_tmpFilename.c_str(), m_filename.c_str()) != 0);
+    auto rename_errno  = errno;
+    if(rename_failed)
+        unlink(m_tmpFilename.c_str());
+
+    INI_THROW_IF(
+        rename_failed,
+        std::runtime_error,
+        "Can't rename file: (%s) to (%s) - %s",
+        m_tmpFilename.c_str(),
+        m_filename   .c_str(),
+        std::strerror(rename_errno)
+    );
+}
+
+
+//----------------------------------------------------------------------------//
+// Private Methods                                                            //
+//----------------------------------------------------------------------------//
+void IniWriter::Put(char c)
+{
+    Put(&c, 1);
+}
+
+void IniWriter::Put(const char *pData, size_t size)
+{
+    INI_THROW_IF(
+        m_fd == -1,
+        std::logic_error,
+        "%s",
+        "IniWriter is already closed."
+    );
+
+    while(size != 0)
+    {
+        if(m_bufferUsed == m_bufferSize)
+            Flush();
+
+        auto count = std::min(size, m_bufferSize - m_bufferUsed);
+        std::memcpy(m_pBuffer.get() + m_bufferUsed, pData, count);
+
+        m_bufferUsed += count;
+        pData        += count;
+        size         -= count;
+    }
+}
+
+void IniWriter::Discard() noexcept
+{
+    if(m_fd == -1)
+        return;
+
+    if(m_ownsFd)
+    {
+        close(m_fd);
+        unlink(m_tmpFilename.c_str());
+    }
+
+    m_fd         = -1;
+    m_bufferUsed = 0;
+}
+
+bool IniWriter::NeedsQuotes(ValueReader reader) const noexcept
+{
+    if(reader.GetSize() == 0)
+        return true;
+
+    auto first = true;
+    auto last  = char(0);
+    while(!reader.IsEof())
+    {
+        auto chunk = reader.ReadChunk();
+
+        //----------------------------------------------------------------------
+        // Surrounding spaces would be trimmed by the parser.
+        if(first && std::isspace(uint8_t(chunk.front())))
+            return true;
+
+        first = false;
+        last  = chunk.back();
+
+        for(auto c : chunk)
+        {
+            if(c == m_keyValueDelimiter || c == ';' || c == '#' || c == '"' ||
+               c == '\\' || c == '\n' || c == '\r' || c == '\t')
+            {
+                return true;
+            }
+        }
+    }
+
+    return std::isspace(uint8_t(last));
+}
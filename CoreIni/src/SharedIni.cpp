@@ -0,0 +1,753 @@
+//~---------------------------------------------------------------------------//
+//                     _______  _______  _______  _     _                     //
+//                    |   _   ||       ||       || | _ | |                    //
+//                    |  |_|  ||       ||   _   || || || |                    //
+//                    |       ||       ||  | |  ||       |                    //
+//                    |       ||      _||  |_|  ||       |                    //
+//                    |   _   ||     |_ |       ||   _   |                    //
+//                    |__| |__||_______||_______||__| |__|                    //
+//                             www.amazingcow.com                             //
+//  File      : SharedIni.cpp                                                 //
+//  Project   : CoreIni                                                       //
+//  Date      : Oct 18, 2026                                                  //
+//  License   : GPLv3                                                         //
+//  Author    : n2omatt <n2omatt@amazingcow.com>                              //
+//  Copyright : AmazingCow - 2017, 2018                                       //
+//                                                                            //
+//  Description :                                                             //
+//    Read-only Ini snapshot shared between processes.                        //
+//---------------------------------------------------------------------------~//
+
+
+// Header
+#include "../include/SharedIni.h"
+// std
+#include <atomic>
+#include <cerrno>
+#include <chrono>
+#include <cstring>
+#include <new>
+#include <thread>
+// POSIX
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+// CoreIni
+#include "../include/ValueReader.h"
+#include "CoreIni_Private.h"
+
+// Usings
+USING_NS_COREINI;
+
+
+//----------------------------------------------------------------------------//
+// Shared Memory Layout                                                       //
+//----------------------------------------------------------------------------//
+// [Header][Sections][Values][Contents][Sections Table][Values Table][Chars]
+//
+// The tables are open addressing hash tables (linear probing) with the
+// record index + 1 on each slot - 0 is an empty slot. The Sections Table
+// is keyed by the section hash, the Values Table by the combined hash of
+// the section and the value.
+//
+// Each snapshot lives on its own segment (name.generation) and the
+// published name is a tiny segment with the generation of the current
+// snapshot - So the name is never missing while a new one is published.
+struct SharedLayout::Pointer
+{
+    // 0 until the first snapshot is ready.
+    std::atomic<uint64_t> generation;
+};
+
+struct SharedLayout::Header
+{
+    // Written last by the publisher, so a worker that attaches while
+    // the segment is being filled knows that it isn't ready yet.
+    std::atomic<uint32_t> magic;
+    uint32_t              version;
+    uint64_t              size;
+    uint64_t              generation;
+    // Set by the publisher when a newer snapshot is published.
+    std::atomic<uint32_t> stale;
+    uint32_t              caseInsensitive;
+
+    uint64_t sectionsOffset;
+    uint64_t sectionsCount;
+    uint64_t valuesOffset;
+    uint64_t valuesCount;
+    uint64_t contentsOffset;
+    uint64_t contentsCount;
+    uint64_t sectionsTableOffset;
+    uint64_t sectionsTableSize;
+    uint64_t valuesTableOffset;
+    uint64_t valuesTableSize;
+};
+
+static_assert(
+    std::atomic<uint32_t>::is_always_lock_free &&
+    std::atomic<uint64_t>::is_always_lock_free,
+    "Shared memory needs lock free atomics."
+);
+
+
+//----------------------------------------------------------------------------//
+// Constants                                                                  //
+//----------------------------------------------------------------------------//
+namespace {
+
+constexpr uint32_t kMagic   = 0x494E4943; // "CINI"
+constexpr uint32_t kVersion = 1;
+
+// How long Attach waits for a name that wasn't published yet or for a
+// snapshot that was replaced while attaching to it.
+constexpr auto kAttachRetries = 100;
+constexpr auto kAttachWait    = std::chrono::milliseconds(1);
+
+
+//----------------------------------------------------------------------------//
+// Helpers                                                                    //
+//----------------------------------------------------------------------------//
+inline std::string SegmentName(const std::string &name, uint64_t generation)
+{
+    return name + "." + std::to_string(generation);
+}
+
+inline uint64_t Align(uint64_t offset) noexcept
+{
+    return (offset + 7) & ~uint64_t(7);
+}
+
+inline uint64_t TableSize(uint64_t count) noexcept
+{
+    //--------------------------------------------------------------------------
+    // Power of 2 at least twice the count - Keeps the probes short.
+    auto size = uint64_t(1);
+    while(size < count * 2)
+        size <<= 1;
+
+    return size;
+}
+
+inline void TableInsert(
+    uint64_t *pTable,
+    uint64_t  tableSize,
+    uint64_t  hash,
+    uint64_t  index) noexcept
+{
+    auto slot = hash & (tableSize - 1);
+    while(pTable[slot] != 0)
+        slot = (slot + 1) & (tableSize - 1);
+
+    pTable[slot] = index + 1;
+}
+
+template <typename T>
+inline const T* At(const uint8_t *pBase, uint64_t offset) noexcept
+{
+    return reinterpret_cast<const T *>(pBase + offset);
+}
+
+inline std::string_view ToView(
+    const uint8_t              *pBase,
+    const SharedLayout::String &str) noexcept
+{
+    return std::string_view(At<char>(pBase, str.offset), str.size);
+}
+
+inline bool NamesEqual(
+    std::string_view   lhs,
+    const std::string &rhs,
+    bool               fold) noexcept
+{
+    if(lhs.size() != rhs.size())
+        return false;
+
+    for(size_t i = 0; i < lhs.size(); ++i)
+    {
+        auto a = (fold) ? Hash::FoldCase(lhs[i]) : lhs[i];
+        auto b = (fold) ? Hash::FoldCase(rhs[i]) : rhs[i];
+        if(a != b)
+            return false;
+    }
+
+    return true;
+}
+
+///-----------------------------------------------------------------------------
+/// @returns
+///   The generation that name points to, 0 if it wasn't published yet.
+inline uint64_t ReadPointer(const std::string &name) noexcept
+{
+    auto fd = shm_open(name.c_str(), O_RDONLY, 0);
+    if(fd == -1)
+        return 0;
+
+    struct stat fd_stat;
+    auto p_map = MAP_FAILED;
+    if(fstat(fd, &fd_stat) == 0 && size_t(fd_stat.st_size) >= sizeof(SharedLayout::Pointer))
+        p_map = mmap(nullptr, sizeof(SharedLayout::Pointer), PROT_READ, MAP_SHARED, fd, 0);
+
+    close(fd);
+    if(p_map == MAP_FAILED)
+        return 0;
+
+    auto p_pointer  = static_cast<const SharedLayout::Pointer *>(p_map);
+    auto generation = p_pointer->generation.load(std::memory_order_acquire);
+    munmap(p_map, sizeof(SharedLayout::Pointer));
+
+    return generation;
+}
+
+} // anonymous namespace
+
+
+//----------------------------------------------------------------------------//
+// SharedValue / SharedSection                                                //
+//----------------------------------------------------------------------------//
+std::string_view SharedValue::GetName() const noexcept
+{
+    return ToView(m_pBase, m_pValue->name);
+}
+
+std::string_view SharedValue::GetContent() const noexcept
+{
+    return GetContent(0);
+}
+
+size_t SharedValue::GetContentsCount() const noexcept
+{
+    return m_pValue->contentsCount;
+}
+
+std::string_view SharedValue::GetContent(size_t index) const noexcept
+{
+    auto p_header   = At<SharedLayout::Header>(m_pBase, 0);
+    auto p_contents = At<SharedLayout::String>(m_pBase, p_header->contentsOffset);
+
+    return ToView(m_pBase, p_contents[m_pValue->firstContent + index]);
+}
+
+std::string_view SharedSection::GetName() const noexcept
+{
+    return ToView(m_pBase, m_pSection->name);
+}
+
+SharedValue SharedSection::GetValue(size_t index) const noexcept
+{
+    auto p_header = At<SharedLayout::Header>(m_pBase, 0);
+    auto p_values = At<SharedLayout::Value >(m_pBase, p_header->valuesOffset);
+
+    return SharedValue(m_pBase, &p_values[m_pSection->firstValue + index]);
+}
+
+
+//----------------------------------------------------------------------------//
+// Static Methods                                                             //
+//----------------------------------------------------------------------------//
+uint64_t SharedIni::Publish(const std::string &name, const Ini &ini)
+{
+    //--------------------------------------------------------------------------
+    // Compute the layout.
+    auto sections_count = uint64_t(ini.m_sections.size());
+    auto values_count   = uint64_t(0);
+    auto contents_count = uint64_t(0);
+    auto chars_count    = uint64_t(0);
+
+    for(const auto &section : ini.m_sections)
+    {
+        chars_count  += section.m_name.size();
+        values_count += section.m_values.size();
+
+        for(const auto &value : section.m_values)
+        {
+            chars_count    += value.m_name.size();
+            contents_count += value.GetContentsCount();
+
+            for(size_t j = 0; j < value.GetContentsCount(); ++j)
+                chars_count += value.GetContentSize(j);
+        }
+    }
+
+    auto sections_table_size = TableSize(sections_count);
+    auto values_table_size   = TableSize(values_count  );
+
+    auto sections_offset       = Align(sizeof(SharedLayout::Header));
+    auto values_offset         = Align(sections_offset + sections_count * sizeof(SharedLayout::Section));
+    auto contents_offset       = Align(values_offset   + values_count   * sizeof(SharedLayout::Value  ));
+    auto sections_table_offset = Align(contents_offset + contents_count * sizeof(SharedLayout::String ));
+    auto values_table_offset   = Align(sections_table_offset + sections_table_size * sizeof(uint64_t));
+    auto chars_offset          = Align(values_table_offset   + values_table_size   * sizeof(uint64_t));
+    auto total_size            = chars_offset + chars_count;
+
+    //--------------------------------------------------------------------------
+    // Map the pointer - Created zeroed by the first publish.
+    auto pointer_fd = shm_open(name.c_str(), O_CREAT | O_RDWR, 0644);
+    INI_THROW_IF(
+        pointer_fd == -1,
+        std::runtime_error,
+        "Can't create shared memory: (%s) - %s",
+        name.c_str(),
+        std::strerror(errno)
+    );
+
+    auto p_pointer_map = MAP_FAILED;
+    struct stat pointer_stat;
+    if(fstat(pointer_fd, &pointer_stat) == 0 &&
+       (size_t(pointer_stat.st_size) >= sizeof(SharedLayout::Pointer) ||
+        ftruncate(pointer_fd, sizeof(SharedLayout::Pointer)) == 0))
+    {
+        p_pointer_map = mmap(nullptr, sizeof(SharedLayout::Pointer), PROT_READ | PROT_WRITE, MAP_SHARED, pointer_fd, 0);
+    }
+
+    auto pointer_errno = errno;
+    close(pointer_fd);
+
+    INI_THROW_IF(
+        p_pointer_map == MAP_FAILED,
+        std::runtime_error,
+        "Can't map shared memory: (%s) - %s",
+        name.c_str(),
+        std::strerror(pointer_errno)
+    );
+
+    auto p_pointer      = static_cast<SharedLayout::Pointer *>(p_pointer_map);
+    auto old_generation = p_pointer->generation.load(std::memory_order_acquire);
+    auto generation     = old_generation + 1;
+    auto segment_name   = SegmentName(name, generation);
+
+    //--------------------------------------------------------------------------
+    // Create the new segment - Nobody reads it until the pointer is moved,
+    // so a leftover of a publisher that died midway can be dropped.
+    shm_unlink(segment_name.c_str());
+
+    auto fd = shm_open(segment_name.c_str(), O_CREAT | O_EXCL | O_RDWR, 0644);
+    auto create_errno = errno;
+    if(fd == -1)
+        munmap(p_pointer_map, sizeof(SharedLayout::Pointer));
+
+    INI_THROW_IF(
+        fd == -1,
+        std::runtime_error,
+        "Can't create shared memory: (%s) - %s",
+        segment_name.c_str(),
+        std::strerror(create_errno)
+    );
+
+    auto p_map = MAP_FAILED;
+    if(ftruncate(fd, off_t(total_size)) == 0)
+        p_map = mmap(nullptr, total_size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+
+    auto map_errno = errno;
+    close(fd);
+
+    if(p_map == MAP_FAILED)
+    {
+        shm_unlink(segment_name.c_str());
+        munmap(p_pointer_map, sizeof(SharedLayout::Pointer));
+    }
+
+    INI_THROW_IF(
+        p_map == MAP_FAILED,
+        std::runtime_error,
+        "Can't map shared memory: (%s) - %s",
+        segment_name.c_str(),
+        std::strerror(map_errno)
+    );
+
+    //--------------------------------------------------------------------------
+    // Fill the segment.
+    auto p_base           = static_cast<uint8_t *>(p_map);
+    auto p_sections       = reinterpret_cast<SharedLayout::Section *>(p_base + sections_offset);
+    auto p_values         = reinterpret_cast<SharedLayout::Value   *>(p_base + values_offset  );
+    auto p_contents       = reinterpret_cast<SharedLayout::String  *>(p_base + contents_offset);
+    auto p_sections_table = reinterpret_cast<uint64_t *>(p_base + sections_table_offset);
+    auto p_values_table   = reinterpret_cast<uint64_t *>(p_base + values_table_offset  );
+
+    auto chars_cursor = chars_offset;
+    auto write_string = [p_base, &chars_cursor](const std::string &str) {
+        auto ref = SharedLayout::String{chars_cursor, str.size()};
+        std::memcpy(p_base + chars_cursor, str.data(), str.size());
+        chars_cursor += str.size();
+
+        return ref;
+    };
+    auto write_content = [p_base, &chars_cursor](ValueReader &reader) {
+        auto ref = SharedLayout::String{chars_cursor, reader.GetSize()};
+        reader.Read(reinterpret_cast<char *>(p_base + chars_cursor), reader.GetSize());
+        chars_cursor += reader.GetSize();
+
+        return ref;
+    };
+
+    auto value_index   = uint64_t(0);
+    auto content_index = uint64_t(0);
+    for(uint64_t i = 0; i < sections_count; ++i)
+    {
+        const auto &section = ini.m_sections[i];
+
+        p_sections[i].name        = write_string(section.m_name);
+        p_sections[i].hash        = section.m_hash;
+        p_sections[i].firstValue  = value_index;
+        p_sections[i].valuesCount = section.m_values.size();
+        p_sections[i].lineNumber  = section.m_lineNumber;
+        TableInsert(p_sections_table, sections_table_size, section.m_hash, i);
+
+        for(const auto &value : section.m_values)
+        {
+            auto &shared_value = p_values[value_index];
+
+            shared_value.name          = write_string(value.m_name);
+            shared_value.hash          = value.m_hash;
+            shared_value.section       = i;
+            shared_value.firstContent  = content_index;
+            shared_value.contentsCount = value.GetContentsCount();
+            shared_value.lineNumber    = value.m_lineNumber;
+
+            for(size_t j = 0; j < value.GetContentsCount(); ++j)
+            {
+                auto reader = ValueReader(value, j);
+                p_contents[content_index++] = write_content(reader);
+            }
+
+            TableInsert(
+                p_values_table,
+                values_table_size,
+                Hash::Combine(section.m_hash, value.m_hash),
+                value_index
+            );
+            ++value_index;
+        }
+    }
+
+    auto p_header = new (p_base) SharedLayout::Header();
+    p_header->version             = kVersion;
+    p_header->size                = total_size;
+    p_header->generation          = generation;
+    p_header->caseInsensitive     = ini.m_caseInsensitive;
+    p_header->sectionsOffset      = sections_offset;
+    p_header->sectionsCount       = sections_count;
+    p_header->valuesOffset        = values_offset;
+    p_header->valuesCount         = values_count;
+    p_header->contentsOffset      = contents_offset;
+    p_header->contentsCount       = contents_count;
+    p_header->sectionsTableOffset = sections_table_offset;
+    p_header->sectionsTableSize   = sections_table_size;
+    p_header->valuesTableOffset   = values_table_offset;
+    p_header->valuesTableSize     = values_table_size;
+    p_header->stale.store(0, std::memory_order_relaxed);
+    p_header->magic.store(kMagic, std::memory_order_release);
+
+    munmap(p_map, total_size);
+
+    //--------------------------------------------------------------------------
+    // Only now the new snapshot is ready, point the name to it and tell
+    // the workers of the old one - Their mappings outlive the unlink.
+    p_pointer->generation.store(generation, std::memory_order_release);
+    munmap(p_pointer_map, sizeof(SharedLayout::Pointer));
+
+    if(old_generation != 0)
+    {
+        auto old_name = SegmentName(name, old_generation);
+        auto old_fd   = shm_open(old_name.c_str(), O_RDWR, 0);
+        if(old_fd != -1)
+        {
+            auto p_old_map = mmap(nullptr, sizeof(SharedLayout::Header), PROT_READ | PROT_WRITE, MAP_SHARED, old_fd, 0);
+            close(old_fd);
+
+            if(p_old_map != MAP_FAILED)
+            {
+                auto p_old_header = static_cast<SharedLayout::Header *>(p_old_map);
+                p_old_header->stale.store(1, std::memory_order_release);
+                munmap(p_old_map, sizeof(SharedLayout::Header));
+            }
+        }
+
+        shm_unlink(old_name.c_str());
+    }
+
+    return generation;
+}
+
+void SharedIni::Unpublish(const std::string &name) noexcept
+{
+    auto generation = ReadPointer(name);
+    if(generation != 0)
+        shm_unlink(SegmentName(name, generation).c_str());
+
+    shm_unlink(name.c_str());
+}
+
+
+//----------------------------------------------------------------------------//
+// CTOR / DTOR                                                                //
+//----------------------------------------------------------------------------//
+SharedIni::SharedIni(const std::string &name)
+    : m_name (name)
+    , m_pBase(nullptr)
+    , m_size (0)
+{
+    Attach(name);
+}
+
+SharedIni::~SharedIni()
+{
+    Detach();
+}
+
+SharedIni::SharedIni(SharedIni &&other) noexcept
+    : m_name (std::move(other.m_name))
+    , m_pBase(other.m_pBase)
+    , m_size (other.m_size )
+{
+    other.m_pBase = nullptr;
+    other.m_size  = 0;
+}
+
+SharedIni& SharedIni::operator=(SharedIni &&other) noexcept
+{
+    if(this != &other)
+    {
+        Detach();
+
+        m_name  = std::move(other.m_name);
+        m_pBase = other.m_pBase;
+        m_size  = other.m_size;
+
+        other.m_pBase = nullptr;
+        other.m_size  = 0;
+    }
+
+    return *this;
+}
+
+
+//----------------------------------------------------------------------------//
+// Generation                                                                 //
+//----------------------------------------------------------------------------//
+uint64_t SharedIni::GetGeneration() const noexcept
+{
+    return GetHeader().generation;
+}
+
+bool SharedIni::IsStale() const noexcept
+{
+    return GetHeader().stale.load(std::memory_order_acquire) != 0;
+}
+
+void SharedIni::Remap()
+{
+    //--------------------------------------------------------------------------
+    // Attach replaces the mapping only if succeeds.
+    Attach(m_name);
+}
+
+
+//----------------------------------------------------------------------------//
+// Get Section                                                                //
+//----------------------------------------------------------------------------//
+SharedSection SharedIni::GetSection(const std::string &path) const
+{
+    auto p_section = FindSection(path);
+
+    INI_THROW_IF(
+        !p_section,
+        std::invalid_argument,
+        "Section doesn't exists - path: (%s)",
+        path.c_str()
+    );
+
+    return SharedSection(m_pBase, p_section);
+}
+
+std::vector<std::string> SharedIni::GetSectionNames() const
+{
+    const auto &header     = GetHeader();
+    auto        p_sections = At<SharedLayout::Section>(m_pBase, header.sectionsOffset);
+
+    auto names = std::vector<std::string>();
+    names.reserve(header.sectionsCount);
+
+    for(uint64_t i = 0; i < header.sectionsCount; ++i)
+        names.emplace_back(ToView(m_pBase, p_sections[i].name));
+
+    return names;
+}
+
+bool SharedIni::SectionExists(const std::string &path) const noexcept
+{
+    return FindSection(path) != nullptr;
+}
+
+
+//----------------------------------------------------------------------------//
+// Get Value                                                                  //
+//----------------------------------------------------------------------------//
+SharedValue SharedIni::GetValue(
+    const std::string &sectionName,
+    const std::string &valueName) const
+{
+    auto p_value = FindValue(sectionName, valueName);
+
+    INI_THROW_IF(
+        !p_value,
+        std::invalid_argument,
+        "Section (%s) - Value (%s) doesn't exists.",
+        sectionName.c_str(),
+        valueName  .c_str()
+    );
+
+    return SharedValue(m_pBase, p_value);
+}
+
+bool SharedIni::ValueExists(
+    const std::string &sectionName,
+    const std::string &valueName) const noexcept
+{
+    return FindValue(sectionName, valueName) != nullptr;
+}
+
+
+//----------------------------------------------------------------------------//
+// Private Methods                                                            //
+//----------------------------------------------------------------------------//
+void SharedIni::Attach(const std::string &name)
+{
+    //--------------------------------------------------------------------------
+    // The name might not be published yet or the snapshot that it points
+    // to might be replaced (and unlinked) before it's opened, so give it
+    // some time and read the pointer again.
+    auto last_error = std::string("Segment isn't ready");
+    for(auto attempt = 0; attempt < kAttachRetries; ++attempt)
+    {
+        if(attempt != 0)
+            std::this_thread::sleep_for(kAttachWait);
+
+        auto generation = ReadPointer(name);
+        if(generation == 0)
+            continue;
+
+        auto fd = shm_open(SegmentName(name, generation).c_str(), O_RDONLY, 0);
+        if(fd == -1)
+        {
+            last_error = std::strerror(errno);
+            if(errno == ENOENT)
+                continue;
+
+            break;
+        }
+
+        struct stat fd_stat;
+        auto size = (fstat(fd, &fd_stat) == 0) ? size_t(fd_stat.st_size) : size_t(0);
+        if(size < sizeof(SharedLayout::Header))
+        {
+            close(fd);
+            continue;
+        }
+
+        auto p_map = mmap(nullptr, size, PROT_READ, MAP_SHARED, fd, 0);
+        close(fd);
+
+        if(p_map == MAP_FAILED)
+        {
+            last_error = std::strerror(errno);
+            break;
+        }
+
+        auto p_header = static_cast<const SharedLayout::Header *>(p_map);
+        if(p_header->magic.load(std::memory_order_acquire) != kMagic)
+        {
+            munmap(p_map, size);
+            continue;
+        }
+
+        if(p_header->version != kVersion || p_header->size != size)
+        {
+            munmap(p_map, size);
+            last_error = "Invalid snapshot";
+            break;
+        }
+
+        Detach();
+        m_pBase = static_cast<const uint8_t *>(p_map);
+        m_size  = size;
+
+        return;
+    }
+
+    INI_THROW_IF(
+        true,
+        std::runtime_error,
+        "Can't attach to shared memory: (%s) - %s",
+        name.c_str(),
+        last_error.c_str()
+    );
+}
+
+void SharedIni::Detach() noexcept
+{
+    if(m_pBase)
+        munmap(const_cast<uint8_t *>(m_pBase), m_size);
+
+    m_pBase = nullptr;
+    m_size  = 0;
+}
+
+const SharedLayout::Header& SharedIni::GetHeader() const noexcept
+{
+    return *At<SharedLayout::Header>(m_pBase, 0);
+}
+
+const SharedLayout::Section* SharedIni::FindSection(
+    const std::string &name) const noexcept
+{
+    const auto &header = GetHeader();
+
+    auto fold       = (header.caseInsensitive != 0);
+    auto hash       = Hash::HashName(name.c_str(), name.size(), fold);
+    auto p_sections = At<SharedLayout::Section>(m_pBase, header.sectionsOffset     );
+    auto p_table    = At<uint64_t             >(m_pBase, header.sectionsTableOffset);
+    auto mask       = header.sectionsTableSize - 1;
+
+    for(auto slot = hash & mask; p_table[slot] != 0; slot = (slot + 1) & mask)
+    {
+        const auto &section = p_sections[p_table[slot] - 1];
+        if(section.hash == hash && NamesEqual(ToView(m_pBase, section.name), name, fold))
+            return &section;
+    }
+
+    return nullptr;
+}
+
+const SharedLayout::Value* SharedIni::FindValue(
+    const std::string &sectionName,
+    const std::string &valueName) const noexcept
+{
+    const auto &header = GetHeader();
+
+    auto fold         = (header.caseInsensitive != 0);
+    auto section_hash = Hash::HashName(sectionName.c_str(), sectionName.size(), fold);
+    auto value_hash   = Hash::HashName(valueName  .c_str(), valueName  .size(), fold);
+    auto hash         = Hash::Combine(section_hash, value_hash);
+
+    auto p_sections = At<SharedLayout::Section>(m_pBase, header.sectionsOffset   );
+    auto p_values   = At<SharedLayout::Value  >(m_pBase, header.valuesOffset     );
+    auto p_table    = At<uint64_t             >(m_pBase, header.valuesTableOffset);
+    auto mask       = header.valuesTableSize - 1;
+
+    for(auto slot = hash & mask; p_table[slot] != 0; slot = (slot + 1) & mask)
+    {
+        const auto &value   = p_values  [p_table[slot] - 1];
+        const auto &section = p_sections[value.section    ];
+
+        if(value.hash   == value_hash   &&
+           section.hash == section_hash &&
+           NamesEqual(ToView(m_pBase, value  .name), valueName,   fold) &&
+           NamesEqual(ToView(m_pBase, section.name), sectionName, fold))
+        {
+            return &value;
+        }
+    }
+
+    return nullptr;
+}
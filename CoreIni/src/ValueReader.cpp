@@ -0,0 +1,130 @@
+//~---------------------------------------------------------------------------//
+//                     _______  _______  _______  _     _                     //
+//                    |   _   ||       ||       || | _ | |                    //
+//                    |  |_|  ||       ||   _   || || || |                    //
+//                    |       ||       ||  | |  ||       |                    //
+//                    |       ||      _||  |_|  ||       |                    //
+//                    |   _   ||     |_ |       ||   _   |                    //
+//                    |__| |__||_______||_______||__| |__|                    //
+//                             www.amazingcow.com                             //
+//  File      : ValueReader.cpp                                               //
+//  Project   : CoreIni                                                       //
+//  Date      : Oct 18, 2026                                                  //
+//  License   : GPLv3                                                         //
+//  Author    : n2omatt <n2omatt@amazingcow.com>                              //
+//  Copyright : AmazingCow - 2017, 2018                                       //
+//                                                                            //
+//  Description :                                                             //
+//    Reads the content of a value in pieces.                                 //
+//---------------------------------------------------------------------------~//
+
+
+
+// Header
+#include "../include/ValueReader.h"
+// std
+#include <algorithm>
+#include <cstring>
+
+// Usings
+USING_NS_COREINI;
+
+
+//----------------------------------------------------------------------------//
+// CTOR / DTOR                                                                //
+//----------------------------------------------------------------------------//
+ValueReader::ValueReader(const Value &value, size_t index /* = 0 */)
+    : m_chunkIndex (0)
+    , m_chunkOffset(0)
+    , m_size       (value.GetContentSize(index))
+{
+    if(index != 0)
+    {
+        m_chunks.emplace_back(value.m_moreContents[index - 1]);
+    }
+    else if(!value.m_pContinuation)
+    {
+        m_chunks.emplace_back(value.m_content);
+    }
+    else
+    {
+        //----------------------------------------------------------------------
+        // The pieces are released by the join - So they're taken with
+        // the buffer that they point to, or the joined content is used.
+        auto &continuation = *value.m_pContinuation;
+        std::lock_guard<std::mutex> lock(continuation.mutex);
+
+        if(continuation.joined.load(std::memory_order_relaxed))
+        {
+            m_chunks.emplace_back(continuation.content);
+        }
+        else
+        {
+            m_chunks  = continuation.segments;
+            m_pPieces = continuation.pPieces;
+        }
+    }
+
+    SkipEmptyChunks();
+}
+
+ValueReader::ValueReader(std::string_view content)
+    : m_chunks     (1, content)
+    , m_chunkIndex (0)
+    , m_chunkOffset(0)
+    , m_size       (content.size())
+{
+    SkipEmptyChunks();
+}
+
+
+//----------------------------------------------------------------------------//
+// Read                                                                       //
+//----------------------------------------------------------------------------//
+std::string_view ValueReader::ReadChunk() noexcept
+{
+    if(IsEof())
+        return std::string_view();
+
+    auto chunk = m_chunks[m_chunkIndex].substr(m_chunkOffset);
+
+    ++m_chunkIndex;
+    m_chunkOffset = 0;
+    SkipEmptyChunks();
+
+    return chunk;
+}
+
+size_t ValueReader::Read(char *pBuffer, size_t size) noexcept
+{
+    auto read = size_t(0);
+    while(read < size && !IsEof())
+    {
+        const auto &chunk = m_chunks[m_chunkIndex];
+
+        auto count = std::min(size - read, chunk.size() - m_chunkOffset);
+        std::memcpy(pBuffer + read, chunk.data() + m_chunkOffset, count);
+
+        read          += count;
+        m_chunkOffset += count;
+
+        if(m_chunkOffset == chunk.size())
+        {
+            ++m_chunkIndex;
+            m_chunkOffset = 0;
+            SkipEmptyChunks();
+        }
+    }
+
+    return read;
+}
+
+
+//----------------------------------------------------------------------------//
+// Private Methods                                                            //
+//----------------------------------------------------------------------------//
+void ValueReader::SkipEmptyChunks() noexcept
+{
+    while(!IsEof() && m_chunks[m_chunkIndex].empty())
+        ++m_chunkIndex;
+}
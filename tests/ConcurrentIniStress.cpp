@@ -0,0 +1,188 @@
+//~---------------------------------------------------------------------------//
+//                     _______  _______  _______  _     _                     //
+//                    |   _   ||       ||       || | _ | |                    //
+//                    |  |_|  ||       ||   _   || || || |                    //
+//                    |       ||       ||  | |  ||       |                    //
+//                    |       ||      _||  |_|  ||       |                    //
+//                    |   _   ||     |_ |       ||   _   |                    //
+//                    |__| |__||_______||_______||__| |__|                    //
+//                             www.amazingcow.com                             //
+//  File      : ConcurrentIniStress.cpp                                       //
+//  Project   : CoreIni                                                       //
+//  Date      : Oct 18, 2026                                                  //
+//  License   : GPLv3                                                         //
+//  Author    : n2omatt <n2omatt@amazingcow.com>                              //
+//  Copyright : AmazingCow - 2017, 2018                                       //
+//                                                                            //
+//  Description :                                                             //
+//    Readers, writers and section changes on a ConcurrentIni.                //
+//---------------------------------------------------------------------------~//
+
+
+
+
+// std
+#include <atomic>
+#include <cstdio>
+#include <cstdlib>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+// CoreIni
+#include "CoreIni/CoreIni.h"
+
+// Usings
+USING_NS_COREINI;
+
+
+//----------------------------------------------------------------------------//
+// Constants                                                                  //
+//----------------------------------------------------------------------------//
+namespace {
+
+constexpr auto kSectionsCount = 8;
+constexpr auto kValuesCount   = 16;
+constexpr auto kReadersCount  = 6;
+constexpr auto kWritersCount  = 3;
+constexpr auto kWritesCount   = 3000;
+constexpr auto kChangesCount  = 300;
+
+std::atomic<int> g_Failures(0);
+
+void Fail(const std::string &message)
+{
+    std::fprintf(stderr, "FAILED: %s\n", message.c_str());
+    ++g_Failures;
+}
+
+std::string SectionName(int index) { return "s" + std::to_string(index); }
+std::string ValueName  (int index) { return "k" + std::to_string(index); }
+
+} // anonymous namespace
+
+
+//----------------------------------------------------------------------------//
+// Threads                                                                    //
+//----------------------------------------------------------------------------//
+namespace {
+
+//------------------------------------------------------------------------------
+// The fixed sections are never removed - Any throw is a failure.
+void Reader(const ConcurrentIni &ini, int id, const std::atomic<bool> &stop)
+{
+    try {
+        while(!stop)
+        {
+            for(int i = 0; i < kSectionsCount; ++i)
+            {
+                auto content = ini.GetValueAs<int>(SectionName(i), ValueName((i + id) % kValuesCount));
+                if(content < 0)
+                    Fail("Negative content on " + SectionName(i));
+            }
+
+            //------------------------------------------------------------------
+            // The changing section may or may not be there - Even right
+            // after checking it.
+            try {
+                if(ini.GetValueAs<int>("x", "a") < 0)
+                    Fail("Negative content on x");
+            } catch(const std::invalid_argument &) {
+                // Removed...
+            }
+        }
+    } catch(const std::exception &e) {
+        Fail(std::string("Reader: ") + e.what());
+    }
+}
+
+void Writer(ConcurrentIni &ini, int id)
+{
+    try {
+        for(int n = 0; n < kWritesCount; ++n)
+        {
+            auto section = SectionName((n + id) % kSectionsCount);
+            auto scratch = "tmp" + std::to_string(id);
+
+            ini.AddValue   (section, ValueName(n % kValuesCount), std::to_string(n));
+            ini.AddValue   (section, scratch, "1");
+            ini.RemoveValue(section, scratch);
+        }
+    } catch(const std::exception &e) {
+        Fail(std::string("Writer: ") + e.what());
+    }
+}
+
+void SectionChanger(ConcurrentIni &ini)
+{
+    try {
+        for(int n = 0; n < kChangesCount; ++n)
+        {
+            ini.AddSection("x");
+            ini.AddValue  ("x", "a", std::to_string(n));
+
+            auto snapshot = ini.Snapshot();
+            const auto &sections = snapshot.GetSections();
+            if(sections.size() != kSectionsCount + 1 || sections.back().GetName() != "x")
+                Fail("Snapshot doesn't have all the sections in order");
+
+            ini.RemoveSection("x");
+        }
+    } catch(const std::exception &e) {
+        Fail(std::string("SectionChanger: ") + e.what());
+    }
+}
+
+} // anonymous namespace
+
+
+//----------------------------------------------------------------------------//
+// Entry Point                                                                //
+//----------------------------------------------------------------------------//
+int main()
+{
+    ConcurrentIni ini(Ini::INI_DUPLICATE_DISALLOW, Ini::INI_DUPLICATE_OVERWRITE);
+    for(int i = 0; i < kSectionsCount; ++i)
+    {
+        ini.AddSection(SectionName(i));
+        for(int j = 0; j < kValuesCount; ++j)
+            ini.AddValue(SectionName(i), ValueName(j), "0");
+    }
+
+    auto stop    = std::atomic<bool>(false);
+    auto readers = std::vector<std::thread>();
+    auto writers = std::vector<std::thread>();
+
+    for(int i = 0; i < kReadersCount; ++i)
+        readers.emplace_back(Reader, std::cref(ini), i, std::cref(stop));
+
+    for(int i = 0; i < kWritersCount; ++i)
+        writers.emplace_back(Writer, std::ref(ini), i);
+
+    writers.emplace_back(SectionChanger, std::ref(ini));
+
+    for(auto &thread : writers) thread.join();
+    stop = true;
+    for(auto &thread : readers) thread.join();
+
+    //--------------------------------------------------------------------------
+    // Only the fixed sections are left, in the order that they were added.
+    auto snapshot = ini.Snapshot();
+    const auto &sections = snapshot.GetSections();
+    if(sections.size() != kSectionsCount)
+        Fail("Snapshot has " + std::to_string(sections.size()) + " sections");
+
+    for(int i = 0; i < kSectionsCount && i < int(sections.size()); ++i)
+    {
+        if(sections[i].GetName() != SectionName(i))
+            Fail("Section " + SectionName(i) + " is out of order");
+        if(sections[i].GetValues().size() != kValuesCount)
+            Fail("Section " + SectionName(i) + " lost values");
+    }
+
+    if(g_Failures != 0)
+        return EXIT_FAILURE;
+
+    std::printf("ConcurrentIniStress: OK\n");
+    return EXIT_SUCCESS;
+}
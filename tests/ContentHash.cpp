@@ -0,0 +1,154 @@
+//~---------------------------------------------------------------------------//
+//                     _______  _______  _______  _     _                     //
+//                    |   _   ||       ||       || | _ | |                    //
+//                    |  |_|  ||       ||   _   || || || |                    //
+//                    |       ||       ||  | |  ||       |                    //
+//                    |       ||      _||  |_|  ||       |                    //
+//                    |   _   ||     |_ |       ||   _   |                    //
+//                    |__| |__||_______||_______||__| |__|                    //
+//                             www.amazingcow.com                             //
+//  File      : ContentHash.cpp                                               //
+//  Project   : CoreIni                                                       //
+//  Date      : Oct 18, 2026                                                  //
+//  License   : GPLv3                                                         //
+//  Author    : n2omatt <n2omatt@amazingcow.com>                              //
+//  Copyright : AmazingCow - 2017, 2018                                       //
+//                                                                            //
+//  Description :                                                             //
+//    Ini content hash as sections and values move around.                    //
+//---------------------------------------------------------------------------~//
+
+
+
+
+// std
+#include <cstdio>
+#include <cstdlib>
+#include <stdexcept>
+#include <string>
+// CoreIni
+#include "CoreIni/CoreIni.h"
+
+// Usings
+USING_NS_COREINI;
+
+
+//----------------------------------------------------------------------------//
+// Constants                                                                  //
+//----------------------------------------------------------------------------//
+namespace {
+
+int g_Failures = 0;
+
+void Fail(const std::string &message)
+{
+    std::fprintf(stderr, "FAILED: %s\n", message.c_str());
+    ++g_Failures;
+}
+
+Ini MakeIni()
+{
+    Ini ini(Ini::INI_COMMENT_DEFAULT, Ini::INI_DUPLICATE_DISALLOW, Ini::INI_DUPLICATE_OVERWRITE);
+    ini.AddSection("a");
+    ini.AddSection("b");
+
+    return ini;
+}
+
+} // anonymous namespace
+
+
+//----------------------------------------------------------------------------//
+// Tests                                                                      //
+//----------------------------------------------------------------------------//
+namespace {
+
+//------------------------------------------------------------------------------
+// The same value on another section is another config.
+void KeyMovesBetweenSections()
+{
+    auto lhs = MakeIni();
+    lhs.AddValue("a", "k", "1");
+    lhs.AddValue("a", "j", "2");
+
+    auto rhs = MakeIni();
+    rhs.AddValue("a", "k", "1");
+    rhs.AddValue("b", "j", "2");
+
+    if(lhs.GetContentHash() == rhs.GetContentHash())
+        Fail("Moved key: same hash");
+
+    //--------------------------------------------------------------------------
+    // Moving it back gives the same hash again.
+    rhs.RemoveValue("b", "j");
+    rhs.AddValue   ("a", "j", "2");
+    if(lhs.GetContentHash() != rhs.GetContentHash())
+        Fail("Moved key back: different hash");
+}
+
+//------------------------------------------------------------------------------
+// Only the sections and values matter, not their order.
+void OrderDoesntMatter()
+{
+    Ini lhs;
+    lhs.AddSection("a"); lhs.AddValue("a", "k", "1"); lhs.AddValue("a", "j", "2");
+    lhs.AddSection("b"); lhs.AddValue("b", "k", "3");
+
+    Ini rhs;
+    rhs.AddSection("b"); rhs.AddValue("b", "k", "3");
+    rhs.AddSection("a"); rhs.AddValue("a", "j", "2"); rhs.AddValue("a", "k", "1");
+
+    if(lhs.GetContentHash() != rhs.GetContentHash())
+        Fail("Order: different hash");
+}
+
+//------------------------------------------------------------------------------
+// Updated as it changes, it must match an Ini built with the final state.
+void ChangesMatchFreshIni()
+{
+    auto changed = MakeIni();
+    changed.AddSection   ("c");
+    changed.AddValue     ("a", "k", "1");
+    changed.AddValue     ("a", "k", "2"); // Overwrite.
+    changed.AddValue     ("b", "x", "3");
+    changed.AddValue     ("c", "y", "4");
+    changed.RemoveValue  ("b", "x");
+    changed.RemoveSection("c");
+
+    auto fresh = MakeIni();
+    fresh.AddValue("a", "k", "2");
+
+    if(changed.GetContentHash() != fresh.GetContentHash())
+        Fail("Changes: different hash than a fresh Ini");
+
+    //--------------------------------------------------------------------------
+    // Empty sections count.
+    auto empty = Ini();
+    empty.AddSection("a");
+    empty.AddValue  ("a", "k", "2");
+    if(empty.GetContentHash() == fresh.GetContentHash())
+        Fail("Changes: empty section wasn't hashed");
+}
+
+} // anonymous namespace
+
+
+//----------------------------------------------------------------------------//
+// Entry Point                                                                //
+//----------------------------------------------------------------------------//
+int main()
+{
+    try {
+        KeyMovesBetweenSections();
+        OrderDoesntMatter      ();
+        ChangesMatchFreshIni   ();
+    } catch(const std::exception &e) {
+        Fail(std::string("Unexpected exception: ") + e.what());
+    }
+
+    if(g_Failures != 0)
+        return EXIT_FAILURE;
+
+    std::printf("ContentHash: OK\n");
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,233 @@
+//~---------------------------------------------------------------------------//
+//                     _______  _______  _______  _     _                     //
+//                    |   _   ||       ||       || | _ | |                    //
+//                    |  |_|  ||       ||   _   || || || |                    //
+//                    |       ||       ||  | |  ||       |                    //
+//                    |       ||      _||  |_|  ||       |                    //
+//                    |   _   ||     |_ |       ||   _   |                    //
+//                    |__| |__||_______||_______||__| |__|                    //
+//                             www.amazingcow.com                             //
+//  File      : ParseDiagnostics.cpp                                          //
+//  Project   : CoreIni                                                       //
+//  Date      : Oct 18, 2026                                                  //
+//  License   : GPLv3                                                         //
+//  Author    : n2omatt <n2omatt@amazingcow.com>                              //
+//  Copyright : AmazingCow - 2017, 2018                                       //
+//                                                                            //
+//  Description :                                                             //
+//    Tolerant and strict parse of malformed lines.                           //
+//---------------------------------------------------------------------------~//
+
+
+
+
+// std
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <stdexcept>
+#include <string>
+// CoreIni
+#include "CoreIni/CoreIni.h"
+
+// Usings
+USING_NS_COREINI;
+
+
+//----------------------------------------------------------------------------//
+// Constants                                                                  //
+//----------------------------------------------------------------------------//
+namespace {
+
+constexpr auto kFilename = "ParseDiagnostics.ini";
+
+// One problem per line, after a value with more than one delimiter.
+constexpr auto kMalformedContents =
+    "[s]\n"
+    "url = http://host/?a=b&c=d\n"
+    "k = 1\n"
+    "k = 2\n"
+    "  oops\n"
+    " = x\n"
+    "y =\n"
+    "[bad\n"
+    "q = \"abc\n";
+
+constexpr auto kGlobalContents =
+    "g = 1\n"
+    "[s]\n"
+    "k = 1\n";
+
+int g_Failures = 0;
+
+void Fail(const std::string &message)
+{
+    std::fprintf(stderr, "FAILED: %s\n", message.c_str());
+    ++g_Failures;
+}
+
+void WriteFile(const char *pContents)
+{
+    std::ofstream(kFilename) << pContents;
+}
+
+Ini Load(uint8_t valueDuplicateMode, bool allowGlobals, uint8_t parseMode)
+{
+    return Ini(
+        kFilename,
+        Ini::INI_COMMENT_DEFAULT,
+        Ini::INI_DUPLICATE_MERGE,
+        valueDuplicateMode,
+        true,         // allowQuoted
+        true,         // allowBackslashes
+        allowGlobals,
+        true,         // allowHierarchy
+        '/',
+        '=',
+        false,        // caseInsensitive
+        parseMode
+    );
+}
+
+} // anonymous namespace
+
+
+//----------------------------------------------------------------------------//
+// Tests                                                                      //
+//----------------------------------------------------------------------------//
+namespace {
+
+//------------------------------------------------------------------------------
+// Only the first delimiter splits the name from the content.
+void SecondDelimiter()
+{
+    WriteFile(kMalformedContents);
+    auto ini = Load(Ini::INI_DUPLICATE_IGNORE, true, Ini::INI_PARSE_TOLERANT);
+
+    if(ini.GetValue("s", "url").GetContent() != "http://host/?a=b&c=d")
+        Fail("Second delimiter: content was split");
+
+    for(const auto &diagnostic : ini.GetDiagnostics())
+    {
+        if(diagnostic.lineNumber == 2)
+            Fail("Second delimiter: line was diagnosed");
+    }
+}
+
+//------------------------------------------------------------------------------
+// Every problem is kept, in order, pointing to the char that caused it.
+void DiagnosticColumns()
+{
+    struct Expected { size_t lineNumber; size_t column; uint8_t kind; };
+    const Expected expected[] = {
+        { 4, 1, Ini::INI_DIAGNOSTIC_DUPLICATE_VALUE    }, // k = 2
+        { 5, 3, Ini::INI_DIAGNOSTIC_MISSING_DELIMITER  }, // oops
+        { 6, 2, Ini::INI_DIAGNOSTIC_EMPTY_NAME         }, // = x
+        { 7, 4, Ini::INI_DIAGNOSTIC_EMPTY_CONTENT      }, // y =
+        { 8, 1, Ini::INI_DIAGNOSTIC_MALFORMED_SECTION  }, // [bad
+        { 9, 5, Ini::INI_DIAGNOSTIC_BAD_QUOTES         }, // q = "abc
+    };
+    constexpr auto expected_count = sizeof(expected) / sizeof(expected[0]);
+
+    WriteFile(kMalformedContents);
+    auto ini = Load(Ini::INI_DUPLICATE_DISALLOW, true, Ini::INI_PARSE_TOLERANT);
+
+    const auto &diagnostics = ini.GetDiagnostics();
+    if(diagnostics.size() != expected_count)
+    {
+        Fail("Diagnostics: got " + std::to_string(diagnostics.size()));
+        return;
+    }
+
+    for(size_t i = 0; i < expected_count; ++i)
+    {
+        const auto &diagnostic = diagnostics[i];
+        const auto  where      = "line " + std::to_string(expected[i].lineNumber);
+
+        if(diagnostic.lineNumber != expected[i].lineNumber)
+            Fail("Diagnostics: wrong line instead of " + where);
+        if(diagnostic.column != expected[i].column)
+            Fail("Diagnostics: column " + std::to_string(diagnostic.column) + " on " + where);
+        if(diagnostic.kind != expected[i].kind)
+            Fail("Diagnostics: wrong kind on " + where);
+        if(diagnostic.message.empty())
+            Fail("Diagnostics: empty message on " + where);
+    }
+}
+
+//------------------------------------------------------------------------------
+// Strict throws on globals and duplicates that aren't allowed, the other
+// problems are diagnosed on both modes.
+void StrictMode()
+{
+    WriteFile(kGlobalContents);
+    try {
+        Load(Ini::INI_DUPLICATE_DISALLOW, false, Ini::INI_PARSE_STRICT);
+        Fail("Strict: global value didn't throw");
+    } catch(const std::logic_error &) {
+        // Expected...
+    }
+
+    WriteFile(kMalformedContents);
+    try {
+        Load(Ini::INI_DUPLICATE_DISALLOW, true, Ini::INI_PARSE_STRICT);
+        Fail("Strict: duplicated value didn't throw");
+    } catch(const std::logic_error &) {
+        // Expected...
+    }
+
+    auto ini = Load(Ini::INI_DUPLICATE_IGNORE, true, Ini::INI_PARSE_STRICT);
+    if(ini.GetDiagnostics().size() != 5)
+        Fail("Strict: malformed lines weren't diagnosed");
+    if(ini.GetValue("s", "k").GetContent() != "1")
+        Fail("Strict: lost the good values");
+}
+
+//------------------------------------------------------------------------------
+// Tolerant reports the same problems and keeps the good data.
+void TolerantMode()
+{
+    WriteFile(kGlobalContents);
+    auto globals = Load(Ini::INI_DUPLICATE_DISALLOW, false, Ini::INI_PARSE_TOLERANT);
+
+    const auto &diagnostics = globals.GetDiagnostics();
+    if(diagnostics.size() != 1 || diagnostics[0].kind != Ini::INI_DIAGNOSTIC_GLOBAL_VALUE)
+        Fail("Tolerant: global value wasn't diagnosed");
+    if(globals.SectionExists(Section::kGlobalName))
+        Fail("Tolerant: global value was kept");
+    if(globals.GetValue("s", "k").GetContent() != "1")
+        Fail("Tolerant: lost the values after the global");
+
+    WriteFile(kMalformedContents);
+    auto duplicates = Load(Ini::INI_DUPLICATE_DISALLOW, true, Ini::INI_PARSE_TOLERANT);
+    if(duplicates.GetValue("s", "k").GetContent() != "1")
+        Fail("Tolerant: duplicated value didn't keep the first one");
+    if(duplicates.GetValues("s", "k").GetCount() != 1)
+        Fail("Tolerant: duplicated value was kept");
+}
+
+} // anonymous namespace
+
+
+//----------------------------------------------------------------------------//
+// Entry Point                                                                //
+//----------------------------------------------------------------------------//
+int main()
+{
+    try {
+        SecondDelimiter  ();
+        DiagnosticColumns();
+        StrictMode       ();
+        TolerantMode     ();
+    } catch(const std::exception &e) {
+        Fail(std::string("Unexpected exception: ") + e.what());
+    }
+
+    std::remove(kFilename);
+
+    if(g_Failures != 0)
+        return EXIT_FAILURE;
+
+    std::printf("ParseDiagnostics: OK\n");
+    return EXIT_SUCCESS;
+}
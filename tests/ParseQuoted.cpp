@@ -0,0 +1,203 @@
+//~---------------------------------------------------------------------------//
+//                     _______  _______  _______  _     _                     //
+//                    |   _   ||       ||       || | _ | |                    //
+//                    |  |_|  ||       ||   _   || || || |                    //
+//                    |       ||       ||  | |  ||       |                    //
+//                    |       ||      _||  |_|  ||       |                    //
+//                    |   _   ||     |_ |       ||   _   |                    //
+//                    |__| |__||_______||_______||__| |__|                    //
+//                             www.amazingcow.com                             //
+//  File      : ParseQuoted.cpp                                               //
+//  Project   : CoreIni                                                       //
+//  Date      : Oct 18, 2026                                                  //
+//  License   : GPLv3                                                         //
+//  Author    : n2omatt <n2omatt@amazingcow.com>                              //
+//  Copyright : AmazingCow - 2017, 2018                                       //
+//                                                                            //
+//  Description :                                                             //
+//    Quoted values, escapes and their round trip through Save.               //
+//---------------------------------------------------------------------------~//
+
+
+
+
+// std
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <stdexcept>
+#include <string>
+// CoreIni
+#include "CoreIni/CoreIni.h"
+
+// Usings
+USING_NS_COREINI;
+
+
+//----------------------------------------------------------------------------//
+// Constants                                                                  //
+//----------------------------------------------------------------------------//
+namespace {
+
+constexpr auto kFilename      = "ParseQuoted.ini";
+constexpr auto kSavedFilename = "ParseQuoted.Saved.ini";
+
+constexpr auto kContents =
+    "[s]\n"
+    "comment   = \"x;y#z\" ; c\n"
+    "delimiter = \"a=b=c\"\n"
+    "escapes   = \"line\\nnext \\\"q\\\" \\\\ tab\\t\"\n"
+    "spaces    = \"  padded  \"\n"
+    "empty     = \"\"\n"
+    "unknown   = \"\\x\"\n"
+    "plain     = plain ; comment\n"
+    "open      = \"abc\n"
+    "trailing  = \"a\" b\n";
+
+// Decoded contents of the values above - The last two are malformed.
+const struct { const char *pName; const char *pContent; } kExpected[] = {
+    { "comment",   "x;y#z"                    },
+    { "delimiter", "a=b=c"                    },
+    { "escapes",   "line\nnext \"q\" \\ tab\t" },
+    { "spaces",    "  padded  "               },
+    { "empty",     ""                         },
+    { "unknown",   "\\x"                      },
+    { "plain",     "plain"                    },
+};
+
+int g_Failures = 0;
+
+void Fail(const std::string &message)
+{
+    std::fprintf(stderr, "FAILED: %s\n", message.c_str());
+    ++g_Failures;
+}
+
+Ini Load(const char *pFilename, bool allowQuoted)
+{
+    return Ini(
+        pFilename,
+        Ini::INI_COMMENT_DEFAULT,
+        Ini::INI_DUPLICATE_MERGE,
+        Ini::INI_DUPLICATE_DISALLOW,
+        allowQuoted,
+        true,         // allowBackslashes
+        true,         // allowGlobals
+        true,         // allowHierarchy
+        '/',
+        '=',
+        false,        // caseInsensitive
+        Ini::INI_PARSE_TOLERANT
+    );
+}
+
+void CheckContents(const Ini &ini, const std::string &what)
+{
+    for(const auto &expected : kExpected)
+    {
+        if(!ini.ValueExists("s", expected.pName))
+            Fail(what + ": (" + expected.pName + ") is missing");
+        else if(ini.GetValue("s", expected.pName).GetContent() != expected.pContent)
+            Fail(what + ": (" + expected.pName + ") wasn't decoded");
+    }
+}
+
+} // anonymous namespace
+
+
+//----------------------------------------------------------------------------//
+// Tests                                                                      //
+//----------------------------------------------------------------------------//
+namespace {
+
+//------------------------------------------------------------------------------
+// Comment chars and delimiters inside the quotes are content and the
+// escapes are decoded.
+void QuotedValues()
+{
+    auto ini = Load(kFilename, true);
+    CheckContents(ini, "Quoted");
+}
+
+//------------------------------------------------------------------------------
+// Quotes that aren't closed or aren't the end of the content are
+// diagnosed and their values dropped.
+void MalformedQuotes()
+{
+    auto ini = Load(kFilename, true);
+
+    const auto &diagnostics = ini.GetDiagnostics();
+    if(diagnostics.size() != 2)
+    {
+        Fail("Malformed: got " + std::to_string(diagnostics.size()) + " diagnostics");
+        return;
+    }
+
+    for(const auto &diagnostic : diagnostics)
+    {
+        if(diagnostic.kind != Ini::INI_DIAGNOSTIC_BAD_QUOTES)
+            Fail("Malformed: wrong kind on line " + std::to_string(diagnostic.lineNumber));
+        if(diagnostic.column != 13)
+            Fail("Malformed: column " + std::to_string(diagnostic.column) + " isn't the quote");
+    }
+
+    if(ini.ValueExists("s", "open") || ini.ValueExists("s", "trailing"))
+        Fail("Malformed: values were kept");
+}
+
+//------------------------------------------------------------------------------
+// Without allowQuoted the quotes are plain chars.
+void QuotesDisallowed()
+{
+    auto ini = Load(kFilename, false);
+
+    if(ini.GetValue("s", "delimiter").GetContent() != "\"a=b=c\"")
+        Fail("Disallowed: quotes were removed");
+    if(ini.GetValue("s", "comment").GetContent() != "\"x")
+        Fail("Disallowed: comment wasn't stripped");
+    if(!ini.GetDiagnostics().empty())
+        Fail("Disallowed: quotes were diagnosed");
+}
+
+//------------------------------------------------------------------------------
+// Save quotes and escapes what needs it, so the contents are read back
+// the same.
+void RoundTrip()
+{
+    Load(kFilename, true).Save(kSavedFilename);
+
+    auto ini = Load(kSavedFilename, true);
+    CheckContents(ini, "Round trip");
+
+    if(!ini.GetDiagnostics().empty())
+        Fail("Round trip: saved file was diagnosed");
+}
+
+} // anonymous namespace
+
+
+//----------------------------------------------------------------------------//
+// Entry Point                                                                //
+//----------------------------------------------------------------------------//
+int main()
+{
+    std::ofstream(kFilename) << kContents;
+
+    try {
+        QuotedValues    ();
+        MalformedQuotes ();
+        QuotesDisallowed();
+        RoundTrip       ();
+    } catch(const std::exception &e) {
+        Fail(std::string("Unexpected exception: ") + e.what());
+    }
+
+    std::remove(kFilename     );
+    std::remove(kSavedFilename);
+
+    if(g_Failures != 0)
+        return EXIT_FAILURE;
+
+    std::printf("ParseQuoted: OK\n");
+    return EXIT_SUCCESS;
+}